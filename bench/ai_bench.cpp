@@ -0,0 +1,53 @@
+#ifndef __AI_BENCH__
+#define __AI_BENCH__
+
+#include "common_bench.hpp"
+#include "../src/ai.hpp"
+#include "../src/strategy.hpp"
+
+static void BM_AiSimulate(benchmark::State& state)
+{
+    Board board = halfPlayedBoard(state.range(0));
+    Ai ai(board.current(), 1);
+
+    ai.readBoard(board);
+
+    for (auto _ : state)
+        ai.simulate();
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_AiSimulate)->Apply(boardSizes);
+
+static void BM_AiSimulateBridges(benchmark::State& state)
+{
+    Board board = halfPlayedBoard(state.range(0));
+    Ai ai(board.current(), 1, true);
+
+    ai.readBoard(board);
+
+    for (auto _ : state)
+        ai.simulate();
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_AiSimulateBridges)->Apply(boardSizes);
+
+static void BM_AIStrategyGetNextMove(benchmark::State& state)
+{
+    Board board = halfPlayedBoard(state.range(0));
+    AIStrategy strategy(board.current(), 100, 1, 1);
+
+    for (auto _ : state) {
+        Position position = strategy.getNextMove(board);
+        benchmark::DoNotOptimize(position);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_AIStrategyGetNextMove)->Apply(boardSizes)->Unit(benchmark::kMillisecond);
+
+#endif // __AI_BENCH__
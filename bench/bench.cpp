@@ -0,0 +1,10 @@
+#include <benchmark/benchmark.h>
+
+#include "graph_bench.cpp"
+#include "dijkstra_bench.cpp"
+#include "board_bench.cpp"
+#include "distance_evaluator_bench.cpp"
+#include "resistance_bench.cpp"
+#include "ai_bench.cpp"
+
+BENCHMARK_MAIN();
@@ -0,0 +1,43 @@
+#ifndef __BOARD_BENCH__
+#define __BOARD_BENCH__
+
+#include "common_bench.hpp"
+
+static void BM_BoardCheckGame(benchmark::State& state)
+{
+    Board board = halfPlayedBoard(state.range(0));
+
+    for (auto _ : state) {
+        board.checkGame();
+        benchmark::DoNotOptimize(board.playerWon());
+    }
+}
+
+BENCHMARK(BM_BoardCheckGame)->Apply(boardSizes);
+
+static void BM_BoardCopy(benchmark::State& state)
+{
+    Board board = halfPlayedBoard(state.range(0));
+
+    for (auto _ : state) {
+        Board copy = board;
+        benchmark::DoNotOptimize(copy.countMovements());
+    }
+}
+
+BENCHMARK(BM_BoardCopy)->Apply(boardSizes);
+
+static void BM_BoardRestore(benchmark::State& state)
+{
+    Board board = halfPlayedBoard(state.range(0));
+    Board copy = board;
+
+    for (auto _ : state) {
+        copy = board;
+        benchmark::DoNotOptimize(copy.countMovements());
+    }
+}
+
+BENCHMARK(BM_BoardRestore)->Apply(boardSizes);
+
+#endif // __BOARD_BENCH__
@@ -0,0 +1,70 @@
+#ifndef __COMMON_BENCH__
+#define __COMMON_BENCH__
+
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "../src/board.hpp"
+#include "../src/graph.hpp"
+#include "../src/random.hpp"
+
+/**
+ * Run a benchmark for each of the board sizes we care about.
+ */
+static void boardSizes(benchmark::internal::Benchmark* benchmark)
+{
+    for (int size : {5, 7, 11, 15, 19, 23})
+        benchmark->Arg(size);
+}
+
+/**
+ * Build a graph with the adjacency of a hex board.
+ *
+ * @param size Size of the board.
+ *
+ * @return Graph with every cell connected to its neighbours.
+ */
+static Graph hexGraph(int size)
+{
+    Graph graph(size*size, size*size*6);
+
+    for (int row = 0; row < size; row++) {
+        for (int col = 0; col < size; col++) {
+            int cell = row * size + col;
+
+            if (col + 1 < size)
+                graph.connect(cell, cell + 1);
+
+            if (row + 1 < size && col > 0)
+                graph.connect(cell, cell + size - 1);
+
+            if (row + 1 < size)
+                graph.connect(cell, cell + size);
+        }
+    }
+
+    return graph;
+}
+
+/**
+ * Build a board in the middle of a game, with half of its cells
+ * played at random but without any winner checks.
+ *
+ * @param size Size of the board.
+ *
+ * @return Board with the random position.
+ */
+static Board halfPlayedBoard(int size)
+{
+    Board board(size, {true, true});
+    Random random(size);
+    std::vector<int> order;
+
+    board.getEmptyCells().permutation(random, order);
+
+    for (int i = 0; i < size * size / 2; i++)
+        board.set(order[i] / size, order[i] % size, false);
+
+    return board;
+}
+
+#endif // __COMMON_BENCH__
@@ -0,0 +1,53 @@
+#ifndef __DIJKSTRA_BENCH__
+#define __DIJKSTRA_BENCH__
+
+#include "common_bench.hpp"
+#include "../src/dijkstra.hpp"
+#include "../src/breadth_first_search.hpp"
+
+static void BM_DijkstraFindShortestPath(benchmark::State& state)
+{
+    int size = state.range(0);
+    Graph graph = hexGraph(size);
+    Dijkstra dijkstra(graph);
+    std::vector<int> path;
+
+    for (auto _ : state) {
+        dijkstra.findShortestPath(0, size*size - 1, path);
+        benchmark::DoNotOptimize(path.data());
+    }
+}
+
+BENCHMARK(BM_DijkstraFindShortestPath)->Apply(boardSizes);
+
+static void BM_DijkstraFindShortestPathCompact(benchmark::State& state)
+{
+    int size = state.range(0);
+    Graph graph = hexGraph(size);
+    graph.compact();
+    Dijkstra dijkstra(graph);
+    std::vector<int> path;
+
+    for (auto _ : state) {
+        dijkstra.findShortestPath(0, size*size - 1, path);
+        benchmark::DoNotOptimize(path.data());
+    }
+}
+
+BENCHMARK(BM_DijkstraFindShortestPathCompact)->Apply(boardSizes);
+
+static void BM_BreadthFirstSearchFindShortestPath(benchmark::State& state)
+{
+    int size = state.range(0);
+    Graph graph = hexGraph(size);
+    BreadthFirstSearch search(graph);
+
+    for (auto _ : state) {
+        std::vector<int> path = search.findShortestPath(0, size*size - 1);
+        benchmark::DoNotOptimize(path.data());
+    }
+}
+
+BENCHMARK(BM_BreadthFirstSearchFindShortestPath)->Apply(boardSizes);
+
+#endif // __DIJKSTRA_BENCH__
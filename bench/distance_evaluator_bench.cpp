@@ -0,0 +1,29 @@
+#ifndef __DISTANCE_EVALUATOR_BENCH__
+#define __DISTANCE_EVALUATOR_BENCH__
+
+#include "common_bench.hpp"
+#include "../src/distance_evaluator.hpp"
+
+static void BM_DistanceEvaluatorMissingStones(benchmark::State& state)
+{
+    Board board = halfPlayedBoard(state.range(0));
+    DistanceEvaluator evaluator(state.range(0));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(evaluator.countMissingStones(board, Turn::Blue));
+}
+
+BENCHMARK(BM_DistanceEvaluatorMissingStones)->Apply(boardSizes);
+
+static void BM_DistanceEvaluatorEvaluate(benchmark::State& state)
+{
+    Board board = halfPlayedBoard(state.range(0));
+    DistanceEvaluator evaluator(state.range(0));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(evaluator.evaluate(board, Turn::Blue));
+}
+
+BENCHMARK(BM_DistanceEvaluatorEvaluate)->Apply(boardSizes);
+
+#endif
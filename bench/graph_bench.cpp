@@ -0,0 +1,51 @@
+#ifndef __GRAPH_BENCH__
+#define __GRAPH_BENCH__
+
+#include "common_bench.hpp"
+#include "../src/bounded_graph.hpp"
+
+static void BM_GraphConnect(benchmark::State& state)
+{
+    int size = state.range(0);
+
+    for (auto _ : state) {
+        Graph graph = hexGraph(size);
+        benchmark::DoNotOptimize(graph.countEdges());
+    }
+
+    state.SetItemsProcessed(state.iterations() * (3*size*size - 4*size + 1));
+}
+
+BENCHMARK(BM_GraphConnect)->Apply(boardSizes);
+
+static void BM_HexGraphConnect(benchmark::State& state)
+{
+    int size = state.range(0);
+
+    for (auto _ : state) {
+        HexGraph graph(size*size);
+
+        for (int row = 0; row < size; row++) {
+            for (int col = 0; col < size; col++) {
+                int cell = row * size + col;
+
+                if (col + 1 < size)
+                    graph.connect(cell, cell + 1);
+
+                if (row + 1 < size && col > 0)
+                    graph.connect(cell, cell + size - 1);
+
+                if (row + 1 < size)
+                    graph.connect(cell, cell + size);
+            }
+        }
+
+        benchmark::DoNotOptimize(graph.countEdges());
+    }
+
+    state.SetItemsProcessed(state.iterations() * (3*size*size - 4*size + 1));
+}
+
+BENCHMARK(BM_HexGraphConnect)->Apply(boardSizes);
+
+#endif // __GRAPH_BENCH__
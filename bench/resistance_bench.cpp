@@ -0,0 +1,18 @@
+#ifndef __RESISTANCE_BENCH__
+#define __RESISTANCE_BENCH__
+
+#include "common_bench.hpp"
+#include "../src/resistance.hpp"
+
+static void BM_ResistanceEvaluate(benchmark::State& state)
+{
+    Board board = halfPlayedBoard(state.range(0));
+    ResistanceEvaluator evaluator(state.range(0));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(evaluator.evaluate(board, Turn::Blue));
+}
+
+BENCHMARK(BM_ResistanceEvaluate)->Apply(boardSizes);
+
+#endif
@@ -1,11 +1,8 @@
+#include <algorithm>
 #include <limits>
 #include "ai.hpp"
 #include "board.hpp"
 
-bool flipCoin() {
-    return rand() > (RAND_MAX / 2);
-}
-
 int BoardEvaluation::getScore(int row, int col)
 {
     if (row < 0 || row >= size || col < 0 || col >= size)
@@ -38,7 +35,56 @@ void BoardEvaluation::deactivate(int row, int col)
     positions[row][col] = std::numeric_limits<int>::min();
 }
 
-Position BoardEvaluation::getBestPosition()
+void BoardEvaluation::record(int row, int col, Turn owner, bool won)
+{
+    if (row < 0 || row >= size || col < 0 || col >= size)
+        throw std::out_of_range("Row or column index is out of range.");
+
+    int color = owner == Turn::Red ? 1 : 0;
+
+    visits[color][row][col]++;
+
+    if (won)
+        wins[color][row][col]++;
+}
+
+double BoardEvaluation::getAmafScore(int row, int col, Turn player) const
+{
+    if (row < 0 || row >= size || col < 0 || col >= size)
+        throw std::out_of_range("Row or column index is out of range.");
+
+    int own = player == Turn::Red ? 1 : 0;
+    int opponent = 1 - own;
+
+    double ownRate = visits[own][row][col] > 0 ? (double) wins[own][row][col] / visits[own][row][col] : 0.5;
+    double opponentRate = visits[opponent][row][col] > 0 ? (double) wins[opponent][row][col] / visits[opponent][row][col] : 0.5;
+
+    return (1 - OPPONENT_WEIGHT) * ownRate + OPPONENT_WEIGHT * opponentRate;
+}
+
+void BoardEvaluation::merge(const BoardEvaluation& other)
+{
+    for (int i = 0; i < size; ++i) {
+        for (int j = 0; j < size; ++j) {
+            for (int color = 0; color < 2; ++color) {
+                visits[color][i][j] += other.visits[color][i][j];
+                wins[color][i][j] += other.wins[color][i][j];
+            }
+
+            if (positions[i][j] == std::numeric_limits<int>::min())
+                continue;
+
+            if (other.positions[i][j] == std::numeric_limits<int>::min()) {
+                positions[i][j] = std::numeric_limits<int>::min();
+                continue;
+            }
+
+            positions[i][j] += other.positions[i][j];
+        }
+    }
+}
+
+Position BoardEvaluation::getBestPosition(Random& random)
 {
     int bestValue = positions[0][0];
     Position bestPosition = {0, 0};
@@ -48,7 +94,7 @@ Position BoardEvaluation::getBestPosition()
             if (positions[i][j] < bestValue)
                 continue;
 
-            if (positions[i][j] == bestValue && flipCoin())
+            if (positions[i][j] == bestValue && random.flipCoin())
                 continue;
 
             bestValue = positions[i][j];
@@ -59,51 +105,322 @@ Position BoardEvaluation::getBestPosition()
     return bestPosition;
 }
 
-Ai::Ai(Turn player) :
+Position BoardEvaluation::getBestPosition(Turn player, Random& random)
+{
+    double bestValue = -1;
+    Position bestPosition = {0, 0};
+
+    for (int i = 0; i < size; ++i) {
+        for (int j = 0; j < size; ++j) {
+            if (positions[i][j] == std::numeric_limits<int>::min())
+                continue;
+
+            double value = getAmafScore(i, j, player);
+
+            if (value < bestValue)
+                continue;
+
+            if (value == bestValue && random.flipCoin())
+                continue;
+
+            bestValue = value;
+            bestPosition = Position({i, j});
+        }
+    }
+
+    return bestPosition;
+}
+
+Ai::Ai(Turn player, uint64_t seed, bool answerBridges, bool amaf) :
     player(player),
     board(Board(23, {true, true})), // Usar una constante explícita en lugar de MAX_BOARD_SIZE
-    evaluation(BoardEvaluation(23))
+    simulation(board),
+    evaluation(BoardEvaluation(23)),
+    playout(answerBridges),
+    random(seed),
+    amaf(amaf),
+    keepingRollouts(false),
+    rolloutCapacity(ROLLOUT_CAPACITY),
+    rolloutWords(0),
+    rolloutCount(0)
 {}
 
-void Ai::readBoard(const Board& externalBoard)
+int Ai::readBoard(const Board& externalBoard)
 {
+    filterRollouts(externalBoard);
+
     board = externalBoard;
-    evaluation = BoardEvaluation(board.getSize());
+    evaluation = BoardEvaluation(board.getSize(), amaf);
+
+    if (! keepingRollouts)
+        return 0;
+
+    reserveRollouts();
+
+    return replayRollouts();
 }
 
 void Ai::simulate()
 {
-    Board simulation = board;
+    const Board* start = &board;
 
-    // Randomize next movements until the board is completed
-    if (simulation.countMovements() == 1 && flipCoin())
+    // Only the pie rule needs a board of its own to be applied on
+    if (board.countMovements() == 1 && random.flipCoin()) {
+        simulation = board;
         simulation.pieRule();
+        start = &simulation;
+    }
 
-    simulation.forEachEmptyPosition([&simulation] (const int row, const int col) {
-        simulation.set(row, col, false);
-    });
+    // Randomize next movements until the board is completed and check who won
+    bool won = playout.run(*start, random) == player;
 
-    // Check who won
-    simulation.checkGame();
+    // Rollouts of the pie rule don't follow from the board, so they aren't kept
+    uint64_t* owned = start == &board ? addRollout(won) : nullptr;
 
     // Evaluate the final position
-    simulation.forEachPiece([&simulation, this] (const int row, const int col, Turn turn) {
-        // If we won, we'll increase the score of our choices
-        if (simulation.playerWon() == this->player && turn == this->player)
-            this->evaluation.increaseScore(row, col);
-
-        // If we losed, we'll decrease the score of our choices
-        if (simulation.playerWon() != this->player && turn == this->player)
-            this->evaluation.decreaseScore(row, col);
-    });
+    evaluate(evaluation, won, owned);
 
     // Make sure initial positions are not considered
-    board.forEachPiece([&simulation, this] (const int row, const int col, Turn turn) {
-        this->evaluation.deactivate(row, col);
+    int size = board.getSize();
+
+    board.getOccupied().forEach([this, size] (int cell) {
+        this->evaluation.deactivate(cell / size, cell % size);
+    });
+}
+
+void Ai::evaluate(BoardEvaluation& target, bool won, uint64_t* owned)
+{
+    int size = board.getSize();
+
+    if (amaf) {
+        // Every cell that was played in the simulation counts, for both colors
+        board.getOccupied().complement().forEach([this, &target, size, won] (int cell) {
+            Turn owner = playout[cell];
+            target.record(cell / size, cell % size, owner, (owner == player) == won);
+        });
+    }
+
+    for (int cell = 0; cell < size * size; ++cell) {
+        if (playout[cell] != player)
+            continue;
+
+        if (owned)
+            owned[cell >> 6] |= uint64_t(1) << (cell & 63);
+
+        // If we won, we'll increase the score of our choices,
+        // if we losed, we'll decrease them
+        if (won)
+            target.increaseScore(cell / size, cell % size);
+        else
+            target.decreaseScore(cell / size, cell % size);
+    }
+}
+
+bool Ai::ponder()
+{
+    if (! keepingRollouts || rolloutCount >= rolloutCapacity)
+        return false;
+
+    // The playout starts with the opponent, whose move isn't known yet
+    bool won = playout.run(board, random) == player;
+    uint64_t* owned = addRollout(won);
+
+    int size = board.getSize();
+
+    for (int cell = 0; cell < size * size; ++cell) {
+        if (playout[cell] == player)
+            owned[cell >> 6] |= uint64_t(1) << (cell & 63);
+    }
+
+    return true;
+}
+
+int Ai::readPonderedBoard(const Ai& ponderer, const Board& externalBoard, int limit)
+{
+    int replayed = readBoard(externalBoard);
+
+    const Board& pondered = ponderer.board;
+
+    if (ponderer.rolloutCount == 0 || pondered.getSize() != externalBoard.getSize())
+        return replayed;
+
+    if (externalBoard.countMovements() != pondered.countMovements() + 1)
+        return replayed;
+
+    // The new board must keep every pondered stone, plus one opponent stone
+    Turn opponent = player == Turn::Blue ? Turn::Red : Turn::Blue;
+
+    for (Turn color : {Turn::Blue, Turn::Red}) {
+        const Bitboard& before = pondered.getPieces(color);
+        int added = color == opponent ? 1 : 0;
+
+        if ((externalBoard.getPieces(color) & before).count() != before.count()
+                || externalBoard.getPieces(color).count() != before.count() + added)
+            return replayed;
+    }
+
+    int move = -1;
+
+    (externalBoard.getOccupied() & pondered.getOccupied().complement()).forEach([&move] (int cell) {
+        move = cell;
+    });
+
+    // Only the rollouts where the opponent took that cell follow from the board
+    Bitboard empty = board.getOccupied().complement();
+    int words = ponderer.rolloutWords;
+    int reused = 0;
+
+    for (int i = 0; i < ponderer.rolloutCount && reused < limit; ++i) {
+        const uint64_t* owned = &ponderer.rollouts[i * words];
+        bool won = ponderer.rolloutWins[i];
+
+        if ((owned[move >> 6] >> (move & 63)) & 1)
+            continue;
+
+        replayRollout(empty, owned, won);
+
+        // They remain samples of the positions that follow this one
+        uint64_t* kept = addRollout(won);
+
+        if (kept)
+            std::copy(owned, owned + words, kept);
+
+        reused++;
+    }
+
+    return replayed + reused;
+}
+
+void Ai::keepRollouts(bool keep, int capacity)
+{
+    keepingRollouts = keep;
+    rolloutCapacity = capacity;
+    rolloutCount = 0;
+
+    if (keep)
+        reserveRollouts();
+}
+
+void Ai::reserveRollouts()
+{
+    int size = board.getSize();
+
+    rolloutWords = (size * size + 63) / 64;
+    rollouts.resize((size_t) rolloutCapacity * rolloutWords);
+    rolloutWins.resize(rolloutCapacity);
+}
+
+uint64_t* Ai::addRollout(bool won)
+{
+    if (! keepingRollouts || rolloutCount >= rolloutCapacity)
+        return nullptr;
+
+    uint64_t* owned = &rollouts[(size_t) rolloutCount * rolloutWords];
+    std::fill(owned, owned + rolloutWords, 0);
+    rolloutWins[rolloutCount++] = won;
+
+    return owned;
+}
+
+void Ai::filterRollouts(const Board& next)
+{
+    if (rolloutCount == 0)
+        return;
+
+    // Whatever happens, the rollouts no longer belong to the board
+    int count = rolloutCount;
+    rolloutCount = 0;
+
+    if (next.getSize() != board.getSize() || next.countMovements() != board.countMovements() + 2)
+        return;
+
+    // The next board must keep every stone, plus one stone of each player
+    for (Turn color : {Turn::Blue, Turn::Red}) {
+        const Bitboard& pieces = board.getPieces(color);
+
+        if ((next.getPieces(color) & pieces).count() != pieces.count()
+                || next.getPieces(color).count() != pieces.count() + 1)
+            return;
+    }
+
+    Turn opponent = player == Turn::Blue ? Turn::Red : Turn::Blue;
+    int move = -1;
+    int reply = -1;
+
+    (next.getOccupied() & board.getOccupied().complement()).forEach([&next, opponent, &move, &reply] (int cell) {
+        if (next.getPieces(opponent).test(cell))
+            reply = cell;
+        else
+            move = cell;
     });
+
+    // Only rollouts that made the same two moves are samples of the next board
+    int kept = 0;
+
+    for (int i = 0; i < count; ++i) {
+        const uint64_t* owned = &rollouts[i * rolloutWords];
+
+        if (! ((owned[move >> 6] >> (move & 63)) & 1) || ((owned[reply >> 6] >> (reply & 63)) & 1))
+            continue;
+
+        std::copy(owned, owned + rolloutWords, &rollouts[kept * rolloutWords]);
+        rolloutWins[kept++] = rolloutWins[i];
+    }
+
+    rolloutCount = kept;
+}
+
+int Ai::replayRollouts()
+{
+    Bitboard empty = board.getOccupied().complement();
+
+    for (int i = 0; i < rolloutCount; ++i)
+        replayRollout(empty, &rollouts[i * rolloutWords], rolloutWins[i]);
+
+    return rolloutCount;
+}
+
+void Ai::replayRollout(const Bitboard& empty, const uint64_t* owned, bool won)
+{
+    int size = board.getSize();
+
+    if (amaf) {
+        Turn opponent = player == Turn::Blue ? Turn::Red : Turn::Blue;
+
+        empty.forEach([this, owned, opponent, size, won] (int cell) {
+            Turn owner = ((owned[cell >> 6] >> (cell & 63)) & 1) ? player : opponent;
+            evaluation.record(cell / size, cell % size, owner, (owner == player) == won);
+        });
+    }
+
+    // Only the cells of the player are scored, and the stones it
+    // already had on the board aren't
+    int words = (size * size + 63) / 64;
+
+    for (int i = 0; i < words; ++i) {
+        for (uint64_t word = owned[i]; word != 0; word &= word - 1) {
+            int cell = i * 64 + __builtin_ctzll(word);
+
+            if (! empty.test(cell))
+                continue;
+
+            if (won)
+                evaluation.increaseScore(cell / size, cell % size);
+            else
+                evaluation.decreaseScore(cell / size, cell % size);
+        }
+    }
+}
+
+void Ai::merge(const Ai& other)
+{
+    evaluation.merge(other.evaluation);
 }
 
 Position Ai::getBestPosition()
 {
-    return evaluation.getBestPosition();
+    if (evaluation.usesAmaf())
+        return evaluation.getBestPosition(player, random);
+
+    return evaluation.getBestPosition(random);
 }
\ No newline at end of file
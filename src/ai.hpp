@@ -3,25 +3,57 @@
 
 #include <limits>
 #include <utility>
+#include <vector>
 #include "common.hpp"
 #include "board.hpp"
+#include "playout.hpp"
+#include "random.hpp"
 
 // Forward declarations
 typedef std::pair<int, int> Position;
 
+/**
+ * The `BoardEvaluation` class accumulates the results of simulations to
+ * choose the best move of a board.
+ *
+ * By default each simulation adds or subtracts a point to the cells taken
+ * by the evaluating player. In all-moves-as-first (AMAF) mode, every cell
+ * also counts how many simulations each color took it and how many of
+ * those it won, and the best move is chosen from those rates.
+ */
 class BoardEvaluation
 {
 private:
     int size;
+    bool amaf;
     int positions[23][23] = {0}; // Usar una constante explícita en lugar de MAX_BOARD_SIZE
 
+    // AMAF statistics of each cell, by color (blue first)
+    int visits[2][23][23] = {{{0}}};
+    int wins[2][23][23] = {{{0}}};
+
 public:
+    /**
+     * Weight of the opponent rate in the blended AMAF score.
+     */
+    static constexpr double OPPONENT_WEIGHT = 0.5;
+
     /**
      * Constructs a new board evaluation object.
      *
      * @param size The size of the board to be evaluated.
+     * @param amaf Whether to choose moves from the AMAF statistics (default: false).
      */
-    BoardEvaluation(int size) : size(size) {}
+    BoardEvaluation(int size, bool amaf = false) : size(size), amaf(amaf) {}
+
+    /**
+     * Check if the evaluation chooses moves from the AMAF statistics.
+     *
+     * @return Whether the AMAF mode is enabled.
+     */
+    bool usesAmaf() const {
+        return amaf;
+    }
 
     /**
      * Retrieves the score at a specific position on the board.
@@ -57,41 +89,207 @@ public:
      */
     void deactivate(int row, int col);
 
+    /**
+     * Records the AMAF statistics of a cell after a simulation.
+     *
+     * @param row The row index of the position.
+     * @param col The column index of the position.
+     * @param owner The color that took the cell in the simulation.
+     * @param won Whether that color won the simulation.
+     */
+    void record(int row, int col, Turn owner, bool won);
+
+    /**
+     * Retrieves the blended AMAF score of a position for a player: the
+     * rate of wins of the player when it takes the cell, blended with the
+     * rate of wins of its opponent when the opponent takes it instead.
+     *
+     * Cells without statistics get a rate of one half.
+     *
+     * @param row The row index of the position.
+     * @param col The column index of the position.
+     * @param player The player whose move is evaluated.
+     *
+     * @return Score between 0 and 1.
+     */
+    double getAmafScore(int row, int col, Turn player) const;
+
+    /**
+     * Adds the scores of another evaluation of the same board to this one.
+     * Positions deactivated in any of the evaluations remain deactivated.
+     *
+     * @param other The evaluation to be merged.
+     */
+    void merge(const BoardEvaluation& other);
+
     /**
      * Retrieves the best position on the board based on some evaluation criteria.
      *
+     * @param random Generator used to break ties.
+     *
      * @return Position The best position found on the board.
      */
-    Position getBestPosition();
-};
+    Position getBestPosition(Random& random = threadRandom());
 
-bool flipCoin();
+    /**
+     * Retrieves the best position on the board for a player, according
+     * to the blended AMAF scores. Deactivated positions are skipped.
+     *
+     * @param player The player whose move is chosen.
+     * @param random Generator used to break ties.
+     *
+     * @return Position The best position found on the board.
+     */
+    Position getBestPosition(Turn player, Random& random = threadRandom());
+};
 
 class Ai
 {
 private:
     Turn player;
     Board board;
+    Board simulation;
     BoardEvaluation evaluation;
+    Playout playout;
+    Random random;
+    bool amaf;
+
+    // Cells taken by the player in each kept rollout, as a fixed number
+    // of words per rollout, and whether the player won it
+    bool keepingRollouts;
+    int rolloutCapacity;
+    int rolloutWords;
+    int rolloutCount;
+    std::vector<uint64_t> rollouts;
+    std::vector<bool> rolloutWins;
+
+    /**
+     * Add the result of the last playout to an evaluation.
+     *
+     * @param target Evaluation to be updated.
+     * @param won Whether the player won the playout.
+     * @param owned Words where the cells of the player are set, if any (default: none).
+     */
+    void evaluate(BoardEvaluation& target, bool won, uint64_t* owned = nullptr);
+
+    /**
+     * Make room for the kept rollouts of the current board size.
+     */
+    void reserveRollouts();
+
+    /**
+     * Take the next free slot to keep a rollout.
+     *
+     * @param won Whether the player won the rollout.
+     *
+     * @return Cleared words of the rollout, or nullptr if rollouts
+     *         aren't kept or there's no room left.
+     */
+    uint64_t* addRollout(bool won);
+
+    /**
+     * Add a rollout that followed from the current board to its evaluation.
+     *
+     * @param empty Empty cells of the current board.
+     * @param owned Words with the cells taken by the player.
+     * @param won Whether the player won the rollout.
+     */
+    void replayRollout(const Bitboard& empty, const uint64_t* owned, bool won);
+
+    /**
+     * Drop the kept rollouts that aren't samples of a new board. They are
+     * when the new board is the current one plus one move of each player,
+     * and the rollout made those same two moves.
+     *
+     * @param next Board that is going to be read.
+     */
+    void filterRollouts(const Board& next);
+
+    /**
+     * Add the kept rollouts to the evaluation of the current board.
+     *
+     * @return Number of rollouts that were replayed.
+     */
+    int replayRollouts();
 
 public:
+    /**
+     * Maximum number of rollouts kept for the next board. Once they are
+     * all taken, further simulations are no longer recorded.
+     */
+    static constexpr int ROLLOUT_CAPACITY = 4096;
+
     /**
      * Create an AI instance.
+     *
+     * @param player The player color (Blue or Red).
+     * @param seed Seed of the random generator used by the simulations.
+     * @param answerBridges Whether the simulations answer bridge intrusions (default: false).
+     * @param amaf Whether moves are chosen from AMAF statistics (default: false).
      */
-    Ai(Turn player);
+    Ai(Turn player, uint64_t seed = Random::systemSeed(), bool answerBridges = false, bool amaf = false);
 
     /**
-     * Read an external board state.
+     * Read an external board state. If rollouts are kept, the ones that
+     * still apply to the new board are replayed on it.
      *
      * @param externalBoard Board with the state to be read.
+     *
+     * @return Number of kept rollouts that were replayed.
      */
-    void readBoard(const Board& externalBoard);
+    int readBoard(const Board& externalBoard);
 
     /**
      * Simulate a board match until its end.
      */
     void simulate();
 
+    /**
+     * Simulate a match from a board where the opponent is on turn, and
+     * keep it without evaluating it, so that it can be replayed once the
+     * opponent actually moves. Rollouts must be kept for it to do anything.
+     *
+     * @return Whether there was room to keep the rollout.
+     */
+    bool ponder();
+
+    /**
+     * Read an external board state, reusing the rollouts pondered by another
+     * AI instance when the board is the pondered one plus an opponent move.
+     * The rollouts where the opponent took that cell are replayed, and kept
+     * for the next board if there's room.
+     *
+     * Each replayed rollout counts as a full simulation, which is only exact
+     * when playouts fill the board uniformly. With bridge answers, the moves
+     * that followed the opponent's are biased by it, so the replayed samples
+     * are approximations.
+     *
+     * @param ponderer AI instance that pondered the previous position.
+     * @param externalBoard Board with the state to be read.
+     * @param limit Maximum number of pondered rollouts to replay (default: all).
+     *
+     * @return Number of pondered and kept rollouts that were replayed.
+     */
+    int readPonderedBoard(const Ai& ponderer, const Board& externalBoard, int limit = std::numeric_limits<int>::max());
+
+    /**
+     * Keep the outcome of a bounded number of simulations, so that the ones
+     * that still apply are replayed when the next board is read. As with
+     * pondered rollouts, they are only exact samples under uniform filling.
+     *
+     * @param keep Whether the rollouts are kept.
+     * @param capacity Maximum number of rollouts kept (default: ROLLOUT_CAPACITY).
+     */
+    void keepRollouts(bool keep, int capacity = ROLLOUT_CAPACITY);
+
+    /**
+     * Add the results of the simulations of another AI instance, that
+     * must have read the same board, to the ones of this instance.
+     *
+     * @param other AI instance whose results will be merged.
+     */
+    void merge(const Ai& other);
+
     /**
      * Retrieves the best position on the board after the simulation
      * series finished.
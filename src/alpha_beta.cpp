@@ -0,0 +1,217 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include "alpha_beta.hpp"
+
+TranspositionTable::TranspositionTable(int bits) :
+    slots(new Slot[1ULL << bits]),
+    mask((1ULL << bits) - 1)
+{
+    clear();
+}
+
+bool TranspositionTable::probe(uint64_t key, TranspositionEntry& entry) const
+{
+    const Slot& slot = slots[key & mask];
+    uint64_t data = slot.data.load(std::memory_order_relaxed);
+    uint64_t check = slot.check.load(std::memory_order_relaxed);
+
+    if ((check ^ data) != key || data == 0)
+        return false;
+
+    entry.score = (int32_t) (data >> 32);
+    entry.move = (int) ((data >> 16) & 0xFFFF) - 1;
+    entry.depth = (int) ((data >> 8) & 0xFF);
+    entry.bound = (Bound) (data & 0xFF);
+
+    return true;
+}
+
+void TranspositionTable::store(uint64_t key, const TranspositionEntry& entry)
+{
+    // Moves are shifted so that an empty slot can't be mistaken for an entry
+    uint64_t data = ((uint64_t) (uint32_t) entry.score << 32)
+        | ((uint64_t) ((entry.move + 1) & 0xFFFF) << 16)
+        | ((uint64_t) (entry.depth & 0xFF) << 8)
+        | (uint64_t) entry.bound;
+
+    Slot& slot = slots[key & mask];
+    slot.check.store(key ^ data, std::memory_order_relaxed);
+    slot.data.store(data, std::memory_order_relaxed);
+}
+
+void TranspositionTable::clear()
+{
+    for (uint64_t i = 0; i <= mask; i++) {
+        slots[i].check.store(0, std::memory_order_relaxed);
+        slots[i].data.store(0, std::memory_order_relaxed);
+    }
+}
+
+AlphaBetaStrategy::AlphaBetaStrategy(Turn player, int budget, int maxDepth, int tableBits) :
+    player(player),
+    budget(budget),
+    maxDepth(maxDepth),
+    table(tableBits),
+    stopped(false),
+    searchedNodes(0)
+{}
+
+int AlphaBetaStrategy::evaluate(const Board& board)
+{
+    return (int) std::lround(evaluator->evaluate(board, board.current()) * 1000);
+}
+
+void AlphaBetaStrategy::orderMoves(int ply, int depth, int tableMove)
+{
+    const Board& board = positions[ply];
+    Board& child = positions[ply + 1];
+    int size = board.getSize();
+    std::vector<std::pair<int, int>>& list = moves[ply];
+
+    list.clear();
+
+    board.getOccupied().complement().forEach([&](int cell) {
+        int score = 0;
+
+        if (cell == tableMove) {
+            score = WIN;
+        } else if (depth > 1) {
+            // Leaves are evaluated anyway, so only inner nodes pay for ordering
+            child = board;
+            child.set(cell / size, cell % size);
+            score = child.playerWon() != Turn::Undecided ? WIN - 1 : -evaluate(child);
+        }
+
+        list.push_back({score, cell});
+    });
+
+    std::stable_sort(list.begin(), list.end(), [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+        return a.first > b.first;
+    });
+}
+
+int AlphaBetaStrategy::search(int ply, int depth, int alpha, int beta, int& bestMove)
+{
+    const Board& board = positions[ply];
+    bestMove = -1;
+
+    // The last move won the game, so the player to move lost it
+    if (board.playerWon() != Turn::Undecided)
+        return -(WIN - ply);
+
+    if (depth == 0)
+        return evaluate(board);
+
+    if (std::chrono::steady_clock::now() > deadline) {
+        stopped = true;
+        return 0;
+    }
+
+    searchedNodes++;
+
+    int originalAlpha = alpha;
+    int tableMove = -1;
+    TranspositionEntry entry;
+
+    if (table.probe(board.getHash(), entry)) {
+        tableMove = entry.move;
+
+        if (entry.depth >= depth && ply > 0) {
+            if (entry.bound == ExactScore)
+                return entry.score;
+
+            if (entry.bound == LowerBound)
+                alpha = std::max(alpha, entry.score);
+            else
+                beta = std::min(beta, entry.score);
+
+            if (alpha >= beta)
+                return entry.score;
+        }
+    }
+
+    orderMoves(ply, depth, tableMove);
+
+    int size = board.getSize();
+    int best = -WIN - 1;
+    int childMove;
+
+    for (const auto& move : moves[ply]) {
+        int cell = move.second;
+
+        positions[ply + 1] = positions[ply];
+        positions[ply + 1].set(cell / size, cell % size);
+
+        int score = -search(ply + 1, depth - 1, -beta, -alpha, childMove);
+
+        if (stopped)
+            return 0;
+
+        if (score > best) {
+            best = score;
+            bestMove = cell;
+        }
+
+        alpha = std::max(alpha, score);
+
+        if (alpha >= beta)
+            break;
+    }
+
+    Bound bound = best <= originalAlpha ? UpperBound : (best >= beta ? LowerBound : ExactScore);
+    table.store(board.getHash(), {best, bestMove, depth, bound});
+
+    return best;
+}
+
+Position AlphaBetaStrategy::getNextMove(const Board& board)
+{
+    int size = board.getSize();
+
+    if (board.getOccupied().count() == size * size)
+        throw std::runtime_error("There are no moves to search");
+
+    if (! evaluator || evaluator->getSize() != size)
+        evaluator = std::make_unique<ResistanceEvaluator>(size);
+
+    if ((int) positions.size() != maxDepth + 1 || positions[0].getSize() != size) {
+        positions.assign(maxDepth + 1, board);
+        moves.assign(maxDepth + 1, std::vector<std::pair<int, int>>());
+    }
+
+    positions[0] = board;
+
+    int bestMove = -1;
+
+    // The first iteration always completes, so there is always a move
+    auto start = std::chrono::steady_clock::now();
+    deadline = std::chrono::steady_clock::time_point::max();
+    stopped = false;
+
+    for (int depth = 1; depth <= maxDepth && depth <= size * size - board.getOccupied().count(); depth++) {
+        int move;
+        int score = search(0, depth, -WIN - 1, WIN + 1, move);
+
+        if (stopped)
+            break;
+
+        bestMove = move;
+
+        // There's nothing left to learn once the game is decided
+        if (std::abs(score) >= WIN - maxDepth)
+            break;
+
+        deadline = start + std::chrono::milliseconds(budget);
+
+        if (std::chrono::steady_clock::now() > deadline)
+            break;
+    }
+
+    return Position({bestMove / size, bestMove % size});
+}
+
+long long AlphaBetaStrategy::countNodes() const
+{
+    return searchedNodes;
+}
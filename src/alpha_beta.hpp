@@ -0,0 +1,163 @@
+#ifndef ALPHA_BETA_H
+#define ALPHA_BETA_H
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include "common.hpp"
+#include "strategy.hpp"
+#include "board.hpp"
+#include "resistance.hpp"
+
+/**
+ * The `Bound` enum tells how a score of the transposition table relates
+ * to the real score of its position.
+ */
+enum Bound { ExactScore = 0, LowerBound = 1, UpperBound = 2 };
+
+/**
+ * The `TranspositionEntry` struct is the result of searching a position.
+ */
+struct TranspositionEntry
+{
+    int score;
+    int move;
+    int depth;
+    Bound bound;
+};
+
+/**
+ * The `TranspositionTable` class caches search results by position key in
+ * a fixed number of slots, replacing old entries when keys collide.
+ *
+ * Every slot stores the packed entry and the entry xor'ed with the key, so
+ * a slot being written while it's read is detected as a mismatch instead
+ * of a wrong result. This makes probing safe without locks.
+ */
+class TranspositionTable
+{
+private:
+    struct Slot {
+        std::atomic<uint64_t> check;
+        std::atomic<uint64_t> data;
+    };
+
+    // Storage of the slots, its size is a power of two
+    std::unique_ptr<Slot[]> slots;
+
+    // Mask that turns a key into a slot number
+    uint64_t mask;
+
+public:
+    /**
+     * Constructor of the table.
+     *
+     * @param bits Logarithm in base 2 of the number of slots.
+     */
+    TranspositionTable(int bits);
+
+    /**
+     * Look for the entry of a position.
+     *
+     * @param key Key of the position.
+     * @param entry Entry that will receive the result.
+     *
+     * @return Whether the position was found.
+     */
+    bool probe(uint64_t key, TranspositionEntry& entry) const;
+
+    /**
+     * Store the entry of a position.
+     *
+     * @param key Key of the position.
+     * @param entry Result of the search.
+     */
+    void store(uint64_t key, const TranspositionEntry& entry);
+
+    /**
+     * Remove every entry.
+     */
+    void clear();
+};
+
+/**
+ * Move strategy based on an iterative deepening alpha-beta search, with
+ * the resistance of the board as the evaluation of its leaves. Positions
+ * are identified in the transposition table by their Zobrist hash.
+ */
+class AlphaBetaStrategy : public MoveStrategy {
+private:
+    Turn player;
+    int budget;
+    int maxDepth;
+    TranspositionTable table;
+    std::unique_ptr<ResistanceEvaluator> evaluator;
+
+    // Position at each ply, restored from its parent before every move
+    std::vector<Board> positions;
+
+    // Ordered moves at each ply
+    std::vector<std::vector<std::pair<int, int>>> moves;
+
+    std::chrono::steady_clock::time_point deadline;
+    bool stopped;
+    long long searchedNodes;
+
+    /**
+     * Evaluate a position from the point of view of the player to move.
+     */
+    int evaluate(const Board& board);
+
+    /**
+     * Fill the moves of a ply, with the move of the table first and the
+     * rest sorted by the static evaluation of the positions they lead to.
+     */
+    void orderMoves(int ply, int depth, int tableMove);
+
+    /**
+     * Search a position with a negamax alpha-beta.
+     *
+     * @param ply Distance to the root.
+     * @param depth Remaining depth.
+     * @param alpha Lower bound of the search window.
+     * @param beta Upper bound of the search window.
+     * @param bestMove Cell that will receive the best move.
+     *
+     * @return Score from the point of view of the player to move.
+     */
+    int search(int ply, int depth, int alpha, int beta, int& bestMove);
+
+public:
+    /**
+     * Scores of won games, bigger than any evaluation.
+     */
+    static constexpr int WIN = 1000000;
+
+    /**
+     * Create an alpha-beta strategy for a specific player
+     *
+     * @param player The player color (Blue or Red)
+     * @param budget Milliseconds per move, deeper iterations are skipped once it's spent (default: 1000)
+     * @param maxDepth Maximum depth of the search (default: 32)
+     * @param tableBits Logarithm in base 2 of the transposition table slots (default: 20)
+     */
+    AlphaBetaStrategy(Turn player, int budget = 1000, int maxDepth = 32, int tableBits = 20);
+
+    /**
+     * Calculate the next move deepening the search until the time is over
+     *
+     * @param board Current game board state
+     * @return Position The best position found for the next move
+     */
+    Position getNextMove(const Board& board) override;
+
+    /**
+     * Get the number of nodes searched in all the calls to getNextMove
+     *
+     * @return Number of nodes
+     */
+    long long countNodes() const;
+};
+
+#endif // ALPHA_BETA_H
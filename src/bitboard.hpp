@@ -0,0 +1,116 @@
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include <cstdint>
+#include <algorithm>
+#include "common.hpp"
+
+/**
+ * Number of 64 bit words needed to store one bit per cell
+ * of the largest supported board.
+ */
+constexpr int BITBOARD_WORDS = (MAX_BOARD_SIZE * MAX_BOARD_SIZE + 63) / 64;
+
+/**
+ * The `Bitboard` class stores one bit per cell of a board, with
+ * cells numbered in the same order as `Board::cell`.
+ *
+ * Only the words needed by the actual board size are touched by its
+ * operations, and its storage is a plain array so copies are cheap.
+ */
+class Bitboard {
+private:
+    int cells;
+    int words;
+    uint64_t bits[BITBOARD_WORDS];
+
+public:
+    Bitboard(int cells) : cells(cells), words((cells + 63) / 64) {
+        std::fill(bits, bits + BITBOARD_WORDS, 0);
+    }
+
+    bool test(int cell) const {
+        return (bits[cell >> 6] >> (cell & 63)) & 1;
+    }
+
+    void set(int cell) {
+        bits[cell >> 6] |= uint64_t(1) << (cell & 63);
+    }
+
+    void reset(int cell) {
+        bits[cell >> 6] &= ~(uint64_t(1) << (cell & 63));
+    }
+
+    /**
+     * Get the number of cells in the set.
+     */
+    int count() const {
+        int total = 0;
+
+        for (int i = 0; i < words; ++i)
+            total += __builtin_popcountll(bits[i]);
+
+        return total;
+    }
+
+    /**
+     * Check if there is any cell in the set.
+     */
+    bool any() const {
+        for (int i = 0; i < words; ++i) {
+            if (bits[i] != 0)
+                return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * Get the cells that are not in the set, without the padding
+     * bits of the last word.
+     */
+    Bitboard complement() const {
+        Bitboard result(cells);
+
+        for (int i = 0; i < words; ++i)
+            result.bits[i] = ~bits[i];
+
+        if (cells & 63)
+            result.bits[words - 1] &= (uint64_t(1) << (cells & 63)) - 1;
+
+        return result;
+    }
+
+    Bitboard operator|(const Bitboard& other) const {
+        Bitboard result(cells);
+
+        for (int i = 0; i < words; ++i)
+            result.bits[i] = bits[i] | other.bits[i];
+
+        return result;
+    }
+
+    Bitboard operator&(const Bitboard& other) const {
+        Bitboard result(cells);
+
+        for (int i = 0; i < words; ++i)
+            result.bits[i] = bits[i] & other.bits[i];
+
+        return result;
+    }
+
+    /**
+     * Call a callback with each cell of the set, in increasing order.
+     *
+     * @param callback Function that will be called back with the cell number.
+     */
+    template<typename Callback>
+    void forEach(Callback callback) const {
+        for (int i = 0; i < words; ++i) {
+            for (uint64_t word = bits[i]; word != 0; word &= word - 1)
+                callback(i * 64 + __builtin_ctzll(word));
+        }
+    }
+};
+
+#endif // BITBOARD_H
@@ -1,7 +1,7 @@
 #include <algorithm>
 #include <iostream>
 #include <cmath>
-#include <random>
+#include "random.hpp"
 #include "board.hpp"
 #include "strategy.hpp"
 
@@ -31,9 +31,13 @@ Board::Board(int size, HumanPlayers humanPlayers) :
     winner(Turn::Undecided),
     movements(0),
     opening(std::make_pair(-1, -1)),
-    blueGraph(size*size, size*size*6),
-    redGraph(size*size, size*size*6),
+    blueGraph(size*size),
+    redGraph(size*size),
+    blueSets(size*size + 2),
+    redSets(size*size + 2),
     positions(size),
+    emptyCells(size*size),
+    hash(0),
     blueStrategy(nullptr),
     redStrategy(nullptr)
 {
@@ -50,29 +54,16 @@ Board::Board(const Board& other) :
     winner(other.winner),
     movements(other.movements),
     opening(other.opening),
-    blueGraph(other.size*other.size, other.size*other.size*6),
-    redGraph(other.size*other.size, other.size*other.size*6),
-    positions(other.size),
+    blueGraph(other.blueGraph),
+    redGraph(other.redGraph),
+    blueSets(other.blueSets),
+    redSets(other.redSets),
+    positions(other.positions),
+    emptyCells(other.emptyCells),
+    hash(other.hash),
     blueStrategy(nullptr),
     redStrategy(nullptr)
-{
-    connectBorders();
-
-    // Copiar todas las posiciones
-    for (int row = 0; row < size; row++) {
-        for (int col = 0; col < size; col++) {
-            Position position = std::make_pair(row, col);
-            positions[position] = other.positions[position];
-            
-            if (positions[position] == Turn::Blue) {
-                connectBlue(row, col);
-            }
-            else if (positions[position] == Turn::Red) {
-                connectRed(row, col);
-            }
-        }
-    }
-}
+{}
 
 Board& Board::operator=(const Board& other)
 {
@@ -87,26 +78,15 @@ Board& Board::operator=(const Board& other)
     movements = other.movements;
     opening = other.opening;
 
-    blueGraph = Graph(size*size, size*size*6);
-    redGraph = Graph(size*size, size*size*6);
-
-    connectBorders();
-
-    positions = Positions(size);
-
-    for (int row = 0; row < size; row++) {
-        for (int col = 0; col < size; col++) {
-            Position position = std::make_pair(row, col);
-            positions[position] = other.positions[position];
-            
-            if (positions[position] == Turn::Blue) {
-                connectBlue(row, col);
-            }
-            else if (positions[position] == Turn::Red) {
-                connectRed(row, col);
-            }
-        }
-    }
+    // Assigning the containers reuses their storage when it's big
+    // enough, so restoring a board of the same size doesn't allocate
+    blueGraph = other.blueGraph;
+    redGraph = other.redGraph;
+    blueSets = other.blueSets;
+    redSets = other.redSets;
+    positions = other.positions;
+    emptyCells = other.emptyCells;
+    hash = other.hash;
     
     // No copiar las estrategias
     blueStrategy = nullptr;
@@ -123,6 +103,16 @@ void Board::setStrategy(Turn player, std::unique_ptr<MoveStrategy> strategy) {
     }
 }
 
+int Board::startBorder() const
+{
+    return size*size;
+}
+
+int Board::endBorder() const
+{
+    return size*size + 1;
+}
+
 void Board::next()
 {
     if (turn == Turn::Blue) {
@@ -133,56 +123,62 @@ void Board::next()
 
     movements++;
 
-    if (playerWon() != Turn::Undecided)
+    if (playerWon() != Turn::Undecided) {
+        if (blueStrategy != nullptr)
+            blueStrategy->stopPondering();
+
+        if (redStrategy != nullptr)
+            redStrategy->stopPondering();
+
         return;
+    }
 
     if (turn == Turn::Blue && !humanPlayers.blue) {
         playBlueMove();
     } else if (turn == Turn::Red && !humanPlayers.red) {
         playRedMove();
+    } else if (turn == Turn::Blue && !humanPlayers.red && redStrategy != nullptr) {
+        // The computer thinks on the human's time
+        redStrategy->ponder(*this);
+    } else if (turn == Turn::Red && !humanPlayers.blue && blueStrategy != nullptr) {
+        blueStrategy->ponder(*this);
     }
 }
 
 void Board::connectBlue(int row, int col)
 {
-    if (exists(row - 1, col) && isBlue(row - 1, col))
-        blueGraph.connect(cell(row, col), cell(row - 1, col));
+    int node = cell(row, col);
 
-    if (exists(row - 1, col + 1) && isBlue(row - 1, col + 1))
-        blueGraph.connect(cell(row, col), cell(row - 1, col + 1));
+    if (col == 0)
+        blueSets.unite(node, startBorder());
 
-    if (exists(row, col - 1) && isBlue(row, col - 1))
-        blueGraph.connect(cell(row, col), cell(row, col - 1));
+    if (col == size - 1)
+        blueSets.unite(node, endBorder());
 
-    if (exists(row, col + 1) && isBlue(row, col + 1))
-        blueGraph.connect(cell(row, col), cell(row, col + 1));
+    Bitboard friends = positions.neighbours(row, col) & positions.pieces(Turn::Blue);
 
-    if (exists(row + 1, col - 1) && isBlue(row + 1, col - 1))
-        blueGraph.connect(cell(row, col), cell(row + 1, col - 1));
-
-    if (exists(row + 1, col) && isBlue(row + 1, col))
-        blueGraph.connect(cell(row, col), cell(row + 1, col));
+    friends.forEach([this, node](int neighbour) {
+        blueGraph.connect(node, neighbour);
+        blueSets.unite(node, neighbour);
+    });
 }
 
 void Board::connectRed(int row, int col)
 {
-    if (exists(row - 1, col) && isRed(row - 1, col))
-        redGraph.connect(cell(row, col), cell(row - 1, col));
+    int node = cell(row, col);
 
-    if (exists(row - 1, col + 1) && isRed(row - 1, col + 1))
-        redGraph.connect(cell(row, col), cell(row - 1, col + 1));
+    if (row == 0)
+        redSets.unite(node, startBorder());
 
-    if (exists(row, col - 1) && isRed(row, col - 1))
-        redGraph.connect(cell(row, col), cell(row, col - 1));
+    if (row == size - 1)
+        redSets.unite(node, endBorder());
 
-    if (exists(row, col + 1) && isRed(row, col + 1))
-        redGraph.connect(cell(row, col), cell(row, col + 1));
+    Bitboard friends = positions.neighbours(row, col) & positions.pieces(Turn::Red);
 
-    if (exists(row + 1, col - 1) && isRed(row + 1, col - 1))
-        redGraph.connect(cell(row, col), cell(row + 1, col - 1));
-
-    if (exists(row + 1, col) && isRed(row + 1, col))
-        redGraph.connect(cell(row, col), cell(row + 1, col));
+    friends.forEach([this, node](int neighbour) {
+        redGraph.connect(node, neighbour);
+        redSets.unite(node, neighbour);
+    });
 }
 
 void Board::playComputerMove()
@@ -228,16 +224,12 @@ void Board::playRedMove()
 
 void Board::checkGame()
 {
-    Dijkstra blueDijkstra(blueGraph);
-
-    if (blueDijkstra.nodesAreConnected(cell(0, 0), cell(size - 1, size - 1))) {
+    if (blueSets.connected(startBorder(), endBorder())) {
         winner = Turn::Blue;
         turn = Turn::Undecided;
     }
 
-    Dijkstra redDijkstra(redGraph);
-
-    if (redDijkstra.nodesAreConnected(cell(0, 0), cell(size - 1, size - 1))) {
+    if (redSets.connected(startBorder(), endBorder())) {
         winner = Turn::Red;
         turn = Turn::Undecided;
     }
@@ -284,19 +276,15 @@ const int& Board::countMovements() const
 
 bool Board::isBlue(int row, int col)
 {
-    Position position = std::make_pair(row, col);
-
-    return positions[position] == Turn::Blue;
+    return positions.pieces(Turn::Blue).test(cell(row, col));
 }
 
 bool Board::isRed(int row, int col)
 {
-    Position position = std::make_pair(row, col);
-
-    return positions[position] == Turn::Red;
+    return positions.pieces(Turn::Red).test(cell(row, col));
 }
 
-Turn Board::playerWon()
+Turn Board::playerWon() const
 {
     return winner;
 }
@@ -314,7 +302,9 @@ void Board::set(int row, int col, bool checkWinner)
     if (opening.first == -1 || opening.second == -1)
         opening = position;
 
-    positions[position] = turn;
+    positions.set(position, turn);
+    emptyCells.remove(cell(row, col));
+    hash ^= ZobristKeys::shared().stone(cell(row, col), turn);
 
     if (turn == Turn::Blue)
         connectBlue(row, col);
@@ -328,7 +318,7 @@ void Board::set(int row, int col, bool checkWinner)
     next();
 }
 
-const Turn& Board::get(int row, int col) const
+Turn Board::get(int row, int col) const
 {
     Position position = std::make_pair(row, col);
     return positions[position];
@@ -344,15 +334,24 @@ void Board::pieRule()
         throw std::invalid_argument("The pie rule can only be invoked by the red player after a blue opening");
     }
 
-    positions[opening] = turn;
+    positions.set(opening, turn);
+
+    int node = cell(opening.first, opening.second);
+    hash ^= ZobristKeys::shared().stone(node, Turn::Blue) ^ ZobristKeys::shared().stone(node, Turn::Red);
+
+    // The opening stone is the only one on the board, so its blue
+    // group can simply be forgotten and rebuilt as a red one
+    blueSets.reset();
+    connectRed(opening.first, opening.second);
+
     next();
 }
 
-const Graph& Board::getBlueGraph() const {
+const HexGraph& Board::getBlueGraph() const {
     return blueGraph;
 }
 
-const Graph& Board::getRedGraph() const {
+const HexGraph& Board::getRedGraph() const {
     return redGraph;
 }
 
@@ -412,46 +411,24 @@ void Board::forEachLine(std::function<void(const char* line)> callback) const
     }
 }
 
-void Board::forEachPiece(std::function<void(const int row, const int col, Turn turn)> callback) const
+const Bitboard& Board::getPieces(Turn player) const
 {
-    Position position;
-
-    for (int i = 0; i < size; i++) {
-        for (int j = 0; j < size; j++) {
-            position = std::make_pair(i, j);
-            if (positions[position] != Turn::Undecided)
-                callback(i, j, positions[position]);
-        }
-    }
+    return positions.pieces(player);
 }
 
-void Board::forEachEmptyPosition(std::function<void(const int row, const int col)> callback) const
+Bitboard Board::getOccupied() const
 {
-    int rowIds[size];
-    int colIds[size];
-
-    for (int i = 0; i < size; ++i) {
-        rowIds[i] = i;
-        colIds[i] = i;
-    }
-
-    std::random_device random_device;
-    std::mt19937 twister(random_device());
-    std::shuffle(rowIds, rowIds + size, twister);
-    std::shuffle(colIds, colIds + size, twister);
-
-    Position position = std::make_pair(rowIds[0], colIds[0]);
+    return positions.occupied();
+}
 
-    for (int i = 0; i < size; ++i) {
-        for (int j = 0; j < size; ++j) {
-            int row = rowIds[i];
-            int col = colIds[j];
-            position = std::make_pair(row, col);
+const EmptyCells& Board::getEmptyCells() const
+{
+    return emptyCells;
+}
 
-            if (positions[position] == Turn::Undecided)
-                callback(row, col);
-        }
-    }
+uint64_t Board::getHash() const
+{
+    return turn == Turn::Red ? hash ^ ZobristKeys::shared().turn() : hash;
 }
 
 std::ostream& operator<<(std::ostream& os, const Board& board)
@@ -4,9 +4,15 @@
 #include <string>
 #include <cstring>
 #include <memory>
+#include <vector>
 #include <utility> // para std::pair
 #include "graph.hpp"
+#include "bounded_graph.hpp"
 #include "dijkstra.hpp"
+#include "union_find.hpp"
+#include "bitboard.hpp"
+#include "random.hpp"
+#include "zobrist.hpp"
 #include "common.hpp"
 #include "strategy.hpp"
 
@@ -35,26 +41,138 @@ struct PairHash {
 };
 
 /**
- * The `Positions` class is used to store the positions of the pieces.
+ * The `Positions` class is used to store the positions of the pieces,
+ * as one bitboard per player.
  */
-constexpr int MAX_BOARD_SIZE = 23;
-
 class Positions {
 private:
     int size;
-    Turn positions[MAX_BOARD_SIZE][MAX_BOARD_SIZE];
+    Bitboard blue;
+    Bitboard red;
 
 public:
-    Positions(int size) : size(size) {
-        std::fill(positions[0], positions[0] + (MAX_BOARD_SIZE * MAX_BOARD_SIZE), Turn::Undecided);
+    Positions(int size) : size(size), blue(size*size), red(size*size) {}
+
+    Turn operator[](const Position& position) const {
+        int cell = position.first * size + position.second;
+
+        if (blue.test(cell))
+            return Turn::Blue;
+
+        if (red.test(cell))
+            return Turn::Red;
+
+        return Turn::Undecided;
+    }
+
+    void set(const Position& position, Turn turn) {
+        int cell = position.first * size + position.second;
+
+        blue.reset(cell);
+        red.reset(cell);
+
+        if (turn == Turn::Blue)
+            blue.set(cell);
+        else if (turn == Turn::Red)
+            red.set(cell);
+    }
+
+    const Bitboard& pieces(Turn turn) const {
+        return turn == Turn::Blue ? blue : red;
     }
 
-    Turn& operator[](const Position& position) {
-        return positions[position.first][position.second];
+    Bitboard occupied() const {
+        return blue | red;
     }
 
-    const Turn& operator[](const Position& position) const {
-        return positions[position.first][position.second];
+    Bitboard empty() const {
+        return occupied().complement();
+    }
+
+    /**
+     * Get the cells that surround a given one.
+     *
+     * @param row The row number.
+     * @param col The column number.
+     *
+     * @return Mask with up to six neighbour cells.
+     */
+    Bitboard neighbours(int row, int col) const {
+        Bitboard mask(size*size);
+        const int offsets[6][2] = {{-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}};
+
+        for (const auto& offset : offsets) {
+            int r = row + offset[0];
+            int c = col + offset[1];
+
+            if (r >= 0 && r < size && c >= 0 && c < size)
+                mask.set(r * size + c);
+        }
+
+        return mask;
+    }
+};
+
+/**
+ * The `EmptyCells` class keeps a compact list of the cells that haven't
+ * been played, so that they can be visited without scanning the board.
+ */
+class EmptyCells {
+private:
+    // Number of cells still empty
+    int count;
+
+    // The empty cells, in the first `count` elements
+    std::vector<int> cells;
+
+    // Position of each cell in the `cells` list
+    std::vector<int> indexes;
+
+public:
+    EmptyCells(int cells) : count(cells), cells(cells), indexes(cells) {
+        for (int cell = 0; cell < cells; ++cell) {
+            this->cells[cell] = cell;
+            indexes[cell] = cell;
+        }
+    }
+
+    int size() const {
+        return count;
+    }
+
+    const int& operator[](int index) const {
+        return cells[index];
+    }
+
+    /**
+     * Remove a cell from the list in constant time, by moving the
+     * last empty cell to its place.
+     *
+     * @param cell Cell number, as returned by `Board::cell`.
+     */
+    void remove(int cell) {
+        int index = indexes[cell];
+        int last = cells[count - 1];
+
+        cells[index] = last;
+        indexes[last] = index;
+        cells[count - 1] = cell;
+        indexes[cell] = count - 1;
+        count--;
+    }
+
+    /**
+     * Write a uniformly random permutation of the empty cells,
+     * using a Fisher-Yates shuffle.
+     *
+     * @param random Generator used to shuffle the cells.
+     * @param order Vector that will receive the cells.
+     */
+    void permutation(Random& random, std::vector<int>& order) const {
+        order.assign(cells.begin(), cells.begin() + count);
+
+        for (int i = count - 1; i > 0; --i)
+            std::swap(order[i], order[random.below(i + 1)]);
     }
 };
 
@@ -85,11 +203,23 @@ private:
     // The piece positions at a given moment
     Positions positions;
 
+    // The cells that haven't been played yet
+    EmptyCells emptyCells;
+
+    // Xor of the Zobrist keys of every stone
+    uint64_t hash;
+
     // The graph that represents cells and their connections
-    Graph blueGraph;
+    HexGraph blueGraph;
 
     // The graph that represents cells and their connections
-    Graph redGraph;
+    HexGraph redGraph;
+
+    // The groups of connected blue cells, plus the left and right borders
+    UnionFind blueSets;
+
+    // The groups of connected red cells, plus the top and bottom borders
+    UnionFind redSets;
 
     // Strategies for computer players
     std::unique_ptr<MoveStrategy> blueStrategy;
@@ -100,6 +230,22 @@ private:
      */
     void connectBorders();
 
+    /**
+     * Get the virtual node that represents the first border of a player
+     * (left for blue, top for red) in its union-find structure.
+     *
+     * @return Node number.
+     */
+    int startBorder() const;
+
+    /**
+     * Get the virtual node that represents the second border of a player
+     * (right for blue, bottom for red) in its union-find structure.
+     *
+     * @return Node number.
+     */
+    int endBorder() const;
+
     /**
      * Passes the turn to the next player
      */
@@ -157,6 +303,9 @@ public:
     /**
      * Assignment operator to allow copying one board to another. Copying boards
      * always results in a copy with AI disabled.
+     *
+     * When both boards have the same size no memory is allocated, which
+     * makes it a cheap way to restore a snapshot of a position.
      * 
      * @param other The board to copy from.
      *
@@ -266,7 +415,7 @@ public:
      *         If the game hasn't finished yet, the
      *         value "undecided" will be returned.
      */
-    Turn playerWon();
+    Turn playerWon() const;
 
     /**
      * Set the given cell with the color of the current player.
@@ -283,7 +432,7 @@ public:
      * @param row The row number.
      * @param col The column number.
      */
-    const Turn& get(int row, int col) const;
+    Turn get(int row, int col) const;
 
     /**
      * Apply the pie rule after the first movement, changing the color
@@ -296,14 +445,14 @@ public:
      *
      * @return Read only pointer to the blue graph.
      */
-    const Graph& getBlueGraph() const;
+    const HexGraph& getBlueGraph() const;
 
     /**
      * Get a read only version of the red graph.
      *
      * @return Read only pointer to the red graph.
      */
-    const Graph& getRedGraph() const;
+    const HexGraph& getRedGraph() const;
 
     /**
      * Facilitate iterating over the lines of the board
@@ -321,18 +470,64 @@ public:
      * standard output.
      *
      * @param callback Function that will be called back
-     *        with the corresponding piece.
+     *        with the row, column and color of each piece.
+     */
+    template<typename Callback>
+    void forEachPiece(Callback&& callback) const {
+        const Bitboard& blue = positions.pieces(Turn::Blue);
+
+        positions.occupied().forEach([this, &blue, &callback](int cell) {
+            callback(cell / size, cell % size, blue.test(cell) ? Turn::Blue : Turn::Red);
+        });
+    }
+
+    /**
+     * Get the cells owned by a player, numbered as in `cell`.
+     *
+     * @param player The player whose pieces are requested.
+     *
+     * @return Read only bitboard with the player's pieces.
+     */
+    const Bitboard& getPieces(Turn player) const;
+
+    /**
+     * Get the cells that have been played by any player.
+     *
+     * @return Bitboard with the occupied cells.
      */
-    void forEachPiece(std::function<void(const int row, const int col, Turn turn)> callback) const;
+    Bitboard getOccupied() const;
 
     /**
-     * Facilitate iterating over the empty positions of the board
-     * in order to fill them in Monte Carlo simulations.
+     * Get the list of cells that haven't been played.
+     *
+     * @return Read only list of empty cells.
+     */
+    const EmptyCells& getEmptyCells() const;
+
+    /**
+     * Get the Zobrist hash of the position, which is updated on every
+     * movement and takes into account which player is on turn.
+     *
+     * @return 64 bit hash of the position.
+     */
+    uint64_t getHash() const;
+
+    /**
+     * Facilitate iterating over the empty positions of the board,
+     * in a uniformly random order, in order to fill them in Monte
+     * Carlo simulations.
      *
      * @param callback Function that will be called back
-     *        with the corresponding empty position.
+     *        with the row and column of each empty position.
      */
-    void forEachEmptyPosition(std::function<void(const int row, const int col)> callback) const;
+    template<typename Callback>
+    void forEachEmptyPosition(Callback&& callback) const {
+        std::vector<int> order;
+        emptyCells.permutation(threadRandom(), order);
+
+        for (int cell : order)
+            callback(cell / size, cell % size);
+    }
 
     /**
      * Override the << operator in order to facilitate streaming the
@@ -0,0 +1,190 @@
+#ifndef BOUNDED_GRAPH_H
+#define BOUNDED_GRAPH_H
+
+#include <array>
+#include <vector>
+#include <stdexcept>
+#include <ostream>
+#include <sstream>
+#include "graph.hpp"
+
+/**
+ * The BoundedGraph class represents a collection of nodes whose number
+ * of connections is limited at compile time.
+ *
+ * Each node stores its targets in a fixed inline array, so all the memory
+ * is allocated on construction and connecting nodes never reaches the heap.
+ * Copying the graph copies two flat buffers.
+ *
+ * Like `Graph`, it doesn't store weights and connections can be added
+ * but not removed. Use `Graph` when the degree of the nodes is unknown.
+ *
+ * @tparam MaxDegree Maximum number of outgoing edges of a node.
+ */
+template<int MaxDegree>
+class BoundedGraph {
+private:
+    // Number of nodes in the graph
+    int nodes;
+
+    // Number of edges in the graph
+    int edges;
+
+    // Number of targets of each node
+    std::vector<int> degrees;
+
+    // Targets of each node, in the order they were connected
+    std::vector<std::array<int, MaxDegree>> targets;
+
+    /**
+     * Append a directed edge without checking if it already exists.
+     *
+     * @param from The source node of the connection.
+     * @param to The target node of the connection.
+     */
+    void append(int from, int to) {
+        if (degrees[from] == MaxDegree) {
+            throw std::length_error(
+                "Can't create the connection because the node has no room left"
+            );
+        }
+
+        targets[from][degrees[from]++] = to;
+        edges++;
+    }
+
+public:
+    /**
+     * Constructor for the BoundedGraph class.
+     *
+     * @param nodes Number of nodes.
+     */
+    BoundedGraph(int nodes) : nodes(nodes), edges(0), degrees(nodes, 0), targets(nodes) {}
+
+    /**
+     * Connects two nodes with an edge.
+     *
+     * @param from The source node of the connection.
+     * @param to The target node of the connection.
+     * @param bidirectional Whether the connection is bidirectional.
+     */
+    void connect(int from, int to, bool bidirectional = true) {
+        if (from < 0 || from >= nodes) {
+            throw std::out_of_range(
+                "Can't create the connection because the from is invalid"
+            );
+        }
+
+        if (to < 0 || to >= nodes) {
+            throw std::out_of_range(
+                "Can't create the connection because the target is invalid"
+            );
+        }
+
+        if (! nodesAreConnected(from, to))
+            append(from, to);
+
+        if (bidirectional && ! nodesAreConnected(to, from))
+            append(to, from);
+    }
+
+    /**
+     * Connects two nodes with a bidirected edge.
+     */
+    void bidirectedConnect(int from, int to) {
+        connect(from, to, true);
+    }
+
+    /**
+     * Connects two nodes with a directed edge.
+     */
+    void directedConnect(int from, int to) {
+        connect(from, to, false);
+    }
+
+    /**
+     * Check if two nodes are connected, looking at most at
+     * `MaxDegree` targets.
+     *
+     * @return Whether the two nodes are connected.
+     */
+    bool nodesAreConnected(int from, int to) const {
+        if (from < 0 || from >= nodes || to < 0 || to >= nodes) {
+            return false;
+        }
+
+        for (int i = 0; i < degrees[from]; ++i) {
+            if (targets[from][i] == to) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Get the number of nodes.
+     */
+    const int& countNodes() const {
+        return nodes;
+    }
+
+    /**
+     * Get the number of edges. Bidirected edges are counted as
+     * two directed edges.
+     */
+    const int& countEdges() const {
+        return edges;
+    }
+
+    /**
+     * Iterate each of the edges of a given node calling a callback.
+     */
+    template<typename Callback>
+    void forEachEdgeFrom(int node, Callback&& callback) const {
+        for (int i = 0; i < degrees[node]; ++i)
+            callback(Edge(node, targets[node][i]));
+    }
+
+    /**
+     * Iterate each of the edges of the graph calling a callback.
+     */
+    template<typename Callback>
+    void forEachEdge(Callback&& callback) const {
+        for (int node = 0; node < nodes; ++node)
+            forEachEdgeFrom(node, callback);
+    }
+
+    /**
+     * Return the graph as a string.
+     *
+     * @return String representation of the graph.
+     */
+    std::string toString() const {
+        std::ostringstream os;
+
+        forEachEdge([&os](const Edge& edge) {
+            os << "(" << edge.from << ") > (" << edge.to << ")" << std::endl;
+        });
+
+        return os.str();
+    }
+
+    /**
+     * Override the << operator in order to facilitate streaming the
+     * graph over a standard output.
+     */
+    friend std::ostream& operator<<(std::ostream& os, const BoundedGraph& graph) {
+        os << graph.toString();
+
+        return os;
+    }
+};
+
+/**
+ * Hex cells have at most six neighbours, and the border chains
+ * only connect cells that are also neighbours.
+ */
+typedef BoundedGraph<6> HexGraph;
+
+#endif // BOUNDED_GRAPH_H
@@ -0,0 +1,164 @@
+#include <algorithm>
+#include <stdexcept>
+#include "breadth_first_search.hpp"
+
+void BreadthFirstSearch::adjust()
+{
+    int nodeCount = graph.countNodes();
+
+    if ((int) distances.size() != nodeCount) {
+        distances.resize(nodeCount);
+        previous.resize(nodeCount);
+        visited.resize(nodeCount);
+    }
+
+    // A 0-1 search may queue a node once per relaxed edge
+    int capacity = std::max(nodeCount, graph.countEdges() + 1);
+
+    if ((int) queue.size() < capacity)
+        queue.resize(capacity);
+}
+
+void BreadthFirstSearch::reset()
+{
+    adjust();
+
+    std::fill(distances.begin(), distances.end(), UNREACHABLE);
+    std::fill(previous.begin(), previous.end(), -1);
+    std::fill(visited.begin(), visited.end(), false);
+
+    head = 0;
+    count = 0;
+}
+
+void BreadthFirstSearch::pushBack(int node)
+{
+    queue[(head + count) % queue.size()] = node;
+    count++;
+}
+
+void BreadthFirstSearch::pushFront(int node)
+{
+    head = (head + queue.size() - 1) % queue.size();
+    queue[head] = node;
+    count++;
+}
+
+int BreadthFirstSearch::popFront()
+{
+    int node = queue[head];
+    head = (head + 1) % queue.size();
+    count--;
+
+    return node;
+}
+
+BreadthFirstSearch::BreadthFirstSearch(const Graph& graph) : graph(graph), head(0), count(0)
+{
+    adjust();
+}
+
+std::vector<int> BreadthFirstSearch::findShortestPath(int start, int end)
+{
+    int nodeCount = graph.countNodes();
+
+    if (start < 0 || start >= nodeCount || end < 0 || end >= nodeCount) {
+        throw std::out_of_range("Invalid start or end node");
+    }
+
+    reset();
+
+    distances[start] = 0;
+    pushBack(start);
+
+    while (count > 0) {
+        int current = popFront();
+
+        if (current == end)
+            break;
+
+        graph.forEachEdgeFrom(current, [&](const Edge& edge) {
+            // The first time a node is reached is always the shortest one
+            if (distances[edge.to] != UNREACHABLE)
+                return;
+
+            distances[edge.to] = distances[current] + 1;
+            previous[edge.to] = current;
+            pushBack(edge.to);
+        });
+    }
+
+    path.clear();
+
+    if (distances[end] == UNREACHABLE)
+        return path;
+
+    for (int at = end; at != -1; at = previous[at]) {
+        path.push_back(at);
+    }
+
+    std::reverse(path.begin(), path.end());
+
+    return path;
+}
+
+bool BreadthFirstSearch::nodesAreConnected(int start, int end)
+{
+    return findShortestPath(start, end).size() > 0;
+}
+
+int BreadthFirstSearch::findCheapestCost(int start, int end, const std::vector<int>& costs)
+{
+    int nodeCount = graph.countNodes();
+
+    if (start < 0 || start >= nodeCount || end < 0 || end >= nodeCount) {
+        throw std::out_of_range("Invalid start or end node");
+    }
+
+    if ((int) costs.size() != nodeCount) {
+        throw std::invalid_argument("There must be one cost per node");
+    }
+
+    reset();
+
+    if (costs[start] == BLOCKED)
+        return UNREACHABLE;
+
+    distances[start] = costs[start];
+    pushBack(start);
+
+    while (count > 0) {
+        int current = popFront();
+
+        // Nodes at the front of the queue are never farther than the
+        // ones behind, so the first visit has the final distance
+        if (visited[current])
+            continue;
+
+        visited[current] = true;
+
+        if (current == end)
+            return distances[current];
+
+        graph.forEachEdgeFrom(current, [&](const Edge& edge) {
+            int cost = costs[edge.to];
+
+            if (cost == BLOCKED || visited[edge.to])
+                return;
+
+            int newDistance = distances[current] + cost;
+
+            if (newDistance >= distances[edge.to])
+                return;
+
+            distances[edge.to] = newDistance;
+
+            if (cost == 0)
+                pushFront(edge.to);
+            else
+                pushBack(edge.to);
+        });
+    }
+
+    return UNREACHABLE;
+}
@@ -0,0 +1,97 @@
+#ifndef BREADTH_FIRST_SEARCH_H
+#define BREADTH_FIRST_SEARCH_H
+
+#include <vector>
+#include <limits>
+#include "graph.hpp"
+
+/**
+ * The BreadthFirstSearch class finds paths in a graph whose edges all
+ * weight the same, which is what `Graph` models, so it gets the same
+ * results as `Dijkstra` without the work of a priority queue.
+ *
+ * It also offers a 0-1 variant, where entering each node costs 0 or 1,
+ * as needed to count how many stones a player still needs to connect
+ * two cells (own stones cost 0 and empty cells cost 1).
+ *
+ * Every buffer, including the queue, is preallocated and reused.
+ */
+class BreadthFirstSearch {
+private:
+    const Graph& graph;
+
+    // Preallocated data structures to minimize memory allocations
+    std::vector<int> distances;
+    std::vector<int> previous;
+    std::vector<bool> visited;
+    std::vector<int> path;
+
+    // Ring buffer used as a double ended queue
+    std::vector<int> queue;
+    int head;
+    int count;
+
+    /**
+     * Adjust the container sizes to the graph.
+     */
+    void adjust();
+
+    /**
+     * Reset the search buffers before a new query.
+     */
+    void reset();
+
+    void pushBack(int node);
+    void pushFront(int node);
+    int popFront();
+
+public:
+    /**
+     * Value of a node cost that makes the node impossible to enter.
+     */
+    static constexpr int BLOCKED = -1;
+
+    /**
+     * Value returned when two nodes can't be connected.
+     */
+    static constexpr int UNREACHABLE = std::numeric_limits<int>::max();
+
+    /**
+     * Constructor that preallocates memory based on graph size
+     *
+     * @param graph The graph to search on
+     */
+    BreadthFirstSearch(const Graph& graph);
+
+    /**
+     * Find the shortest path between two nodes
+     *
+     * @param start Starting node
+     * @param end Destination node
+     *
+     * @return Vector of nodes representing the shortest path
+     */
+    std::vector<int> findShortestPath(int start, int end);
+
+    /**
+     * Check if two nodes are connected.
+     *
+     * @return Whether the nodes are connected.
+     */
+    bool nodesAreConnected(int start, int end);
+
+    /**
+     * Find the cheapest cost to go from a node to another, where
+     * entering each node has a cost of 0 or 1 or is not possible.
+     *
+     * @param start Starting node
+     * @param end Destination node
+     * @param costs Cost of each node: 0, 1 or BLOCKED.
+     *              The start node's cost is also counted.
+     *
+     * @return Cost of the cheapest path, or UNREACHABLE.
+     */
+    int findCheapestCost(int start, int end, const std::vector<int>& costs);
+};
+
+#endif // BREADTH_FIRST_SEARCH_H
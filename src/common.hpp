@@ -9,6 +9,11 @@
  */
 enum Turn { Undecided = 0, Blue = 1, Red = 2 };
 
+/**
+ * The `MAX_BOARD_SIZE` constant is the largest supported board size.
+ */
+constexpr int MAX_BOARD_SIZE = 23;
+
 /**
  * The `Position` type is used to store a reference to a cell.
  */
@@ -1,32 +1,36 @@
+#include <algorithm>
 #include "graph.hpp"
 #include "dijkstra.hpp"
 
-void Dijkstra::adjust()
+void DijkstraWorkspace::prepare(int nodeCount)
 {
-    int nodeCount = graph.countNodes();
+    if ((int) reached.size() < nodeCount) {
+        reached.resize(nodeCount, 0);
+        visited.resize(nodeCount, 0);
+        distances.resize(nodeCount);
+        previous.resize(nodeCount);
+    }
 
-    if (distances.capacity() >= nodeCount)
-        return;
+    generation++;
 
-    distances.resize(nodeCount, std::numeric_limits<int>::max());
-    previous.resize(nodeCount, -1);
-    visited.resize(nodeCount, false);
+    // When the counter wraps around, old stamps could look current
+    if (generation == 0) {
+        std::fill(reached.begin(), reached.end(), 0);
+        std::fill(visited.begin(), visited.end(), 0);
+        generation = 1;
+    }
 
-    std::pair<int, int> distancePair = std::make_pair(0, -1);
-    queueContainer.resize(nodeCount, distancePair);
+    heap.clear();
+}
 
-    queue = std::priority_queue<
-        std::pair<int, int>,
-        std::vector<std::pair<int, int>>,
-        DistanceCompare>(comparator, std::move(queueContainer));
+Dijkstra::Dijkstra(Graph& graph) : graph(graph), workspace(ownWorkspace) {}
 
-    int edgeCount = graph.countEdges();
-    path.resize(edgeCount);
-}
+Dijkstra::Dijkstra(Graph& graph, DijkstraWorkspace& workspace) : graph(graph), workspace(workspace) {}
 
-Dijkstra::Dijkstra(Graph& graph) : graph(graph), comparator() {
-    adjust();
-}
+Dijkstra::Dijkstra(const Dijkstra& other) :
+    graph(other.graph),
+    workspace(&other.workspace == &other.ownWorkspace ? ownWorkspace : other.workspace)
+{}
 
 Dijkstra& Dijkstra::operator=(const Dijkstra& other)
 {
@@ -35,67 +39,82 @@ Dijkstra& Dijkstra::operator=(const Dijkstra& other)
     }
 
     graph = other.graph;
-    adjust();
 
     return *this;
 }
 
 std::vector<int> Dijkstra::findShortestPath(int start, int end) {
+    std::vector<int> path;
+    findShortestPath(start, end, path);
+
+    return path;
+}
+
+bool Dijkstra::findShortestPath(int start, int end, std::vector<int>& path) {
     int nodeCount = graph.countNodes();
 
     if (start < 0 || start >= nodeCount || end < 0 || end >= nodeCount) {
         throw std::out_of_range("Invalid start or end node");
     }
 
-    std::fill(distances.begin(), distances.end(), std::numeric_limits<int>::max());
-    std::fill(previous.begin(), previous.end(), -1);
-    std::fill(visited.begin(), visited.end(), false);
+    DijkstraWorkspace& ws = workspace;
+    DistanceCompare comparator;
 
-    queueContainer.clear();
+    ws.prepare(nodeCount);
 
-    distances[start] = 0;
+    unsigned generation = ws.generation;
 
-    queue.push(std::make_pair(0, start));
+    ws.reached[start] = generation;
+    ws.distances[start] = 0;
+    ws.previous[start] = -1;
 
-    while (! queue.empty()) {
-        int current = queue.top().second;
+    ws.heap.push_back(std::make_pair(0, start));
 
-        queue.pop();
+    while (! ws.heap.empty()) {
+        std::pop_heap(ws.heap.begin(), ws.heap.end(), comparator);
+        int current = ws.heap.back().second;
+        ws.heap.pop_back();
 
         if (current == end)
             break;
 
-        if (current == -1 || visited[current])
+        if (ws.visited[current] == generation)
             continue;
 
-        visited[current] = true;
+        ws.visited[current] = generation;
 
         graph.forEachEdgeFrom(current, [&](const Edge& edge) {
-            if (visited[edge.to])
+            if (ws.visited[edge.to] == generation)
                 return;
 
-            int newDistance = distances[current] + 1;
+            int newDistance = ws.distances[current] + 1;
 
-            if (newDistance < distances[edge.to]) {
-                distances[edge.to] = newDistance;
-                previous[edge.to] = current;
-                queue.push(std::make_pair(newDistance, edge.to));
+            if (ws.reached[edge.to] != generation || newDistance < ws.distances[edge.to]) {
+                ws.reached[edge.to] = generation;
+                ws.distances[edge.to] = newDistance;
+                ws.previous[edge.to] = current;
+                ws.heap.push_back(std::make_pair(newDistance, edge.to));
+                std::push_heap(ws.heap.begin(), ws.heap.end(), comparator);
             }
         });
     }
 
     path.clear();
-    for (int at = end; at != -1; at = previous[at]) {
+
+    if (ws.reached[end] != generation)
+        return false;
+
+    for (int at = end; at != -1; at = ws.previous[at]) {
         path.push_back(at);
     }
 
     std::reverse(path.begin(), path.end());
 
-    return (path[0] == start) ? path : std::vector<int>();
+    return true;
 }
 
 bool Dijkstra::nodesAreConnected(int start, int end) {
-    std::vector<int> path = findShortestPath(start, end);
+    std::vector<int>& path = workspace.path;
 
-    return path.size() > 0;
-}
\ No newline at end of file
+    return findShortestPath(start, end, path);
+}
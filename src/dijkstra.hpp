@@ -2,21 +2,55 @@
 #define DIJKSTRA_H
 
 #include <vector>
-#include <queue>
 #include <limits>
 #include <utility>
 #include "graph.hpp"
 
-class Dijkstra {
-private:
-    Graph& graph;
+/**
+ * The DijkstraWorkspace struct holds the buffers used by the searches,
+ * so that many queries, even over different graphs, can share them.
+ *
+ * Instead of clearing the buffers before each query, every query gets a
+ * new generation number, and the entries stamped with an older one are
+ * considered empty.
+ */
+struct DijkstraWorkspace
+{
+    // Generation of the current query
+    unsigned generation = 0;
+
+    // Generation in which each node got a distance
+    std::vector<unsigned> reached;
+
+    // Generation in which each node was visited
+    std::vector<unsigned> visited;
 
-    // Preallocated data structures to minimize memory allocations
     std::vector<int> distances;
     std::vector<int> previous;
-    std::vector<bool> visited;
+
+    // Binary heap of (distance, node) pairs, reused between queries
+    std::vector<std::pair<int, int>> heap;
+
+    // Path buffer for the queries that don't return the path
     std::vector<int> path;
-    std::vector<std::pair<int, int>> queueContainer;
+
+    /**
+     * Get the buffers ready for a new query.
+     *
+     * @param nodeCount Number of nodes of the graph to be searched.
+     */
+    void prepare(int nodeCount);
+};
+
+class Dijkstra {
+private:
+    Graph& graph;
+
+    // Buffers used when no workspace is shared
+    DijkstraWorkspace ownWorkspace;
+
+    // Buffers used by the queries
+    DijkstraWorkspace& workspace;
 
     struct DistanceCompare {
         bool operator()(const std::pair<int, int>& a, const std::pair<int, int>& b) const {
@@ -24,25 +58,30 @@ private:
         }
     };
 
-    DistanceCompare comparator;
-
-    std::priority_queue<
-        std::pair<int, int>,
-        std::vector<std::pair<int, int>>,
-        DistanceCompare> queue;
-
-    /**
-     * Adjust the container sizes.
-     */
-    void adjust();
 public:
     /**
-     * Constructor that preallocates memory based on graph size
+     * Constructor of a search with its own workspace
      *
      * @param graph The graph to perform Dijkstra's algorithm on
      */
     Dijkstra(Graph& graph);
 
+    /**
+     * Constructor of a search that uses a shared workspace
+     *
+     * @param graph The graph to perform Dijkstra's algorithm on
+     * @param workspace Buffers that may be shared with other searches
+     */
+    Dijkstra(Graph& graph, DijkstraWorkspace& workspace);
+
+    /**
+     * Copy constructor. The copy shares the workspace of the original
+     * only if the original was using a shared one.
+     *
+     * @param other The search to copy from.
+     */
+    Dijkstra(const Dijkstra& other);
+
     /**
      * Assignment operator to allow copying one graph to another.
      * 
@@ -62,6 +101,19 @@ public:
      */
     std::vector<int> findShortestPath(int start, int end);
 
+    /**
+     * Find the shortest path between two nodes, writing it in a
+     * vector owned by the caller so that it can be reused
+     *
+     * @param start Starting node
+     * @param end Destination node
+     * @param path Vector that will receive the nodes of the path,
+     *             or that will be emptied if there is no path
+     *
+     * @return Whether a path was found
+     */
+    bool findShortestPath(int start, int end, std::vector<int>& path);
+
     /**
      * Check if two nodes are connected.
      *
@@ -70,4 +122,4 @@ public:
     bool nodesAreConnected(int start, int end);
 };
 
-#endif // DIJKSTRA_H
\ No newline at end of file
+#endif // DIJKSTRA_H
@@ -0,0 +1,241 @@
+#include <algorithm>
+#include <stdexcept>
+#include "distance_evaluator.hpp"
+#include "board.hpp"
+
+DistanceEvaluator::DistanceEvaluator(int size) :
+    size(size),
+    graph(size*size + 4, size*size*6 + size*8),
+    search(graph),
+    groups(size*size + 4),
+    costs(size*size + 4),
+    owners(size*size),
+    liberties(size*size + 4, Bitboard(size*size)),
+    neighbourhoods(size*size, Bitboard(size*size)),
+    startDistances(size*size),
+    endDistances(size*size)
+{
+    for (int row = 0; row < size; row++) {
+        for (int col = 0; col < size; col++) {
+            int cell = row * size + col;
+
+            if (col + 1 < size)
+                graph.connect(cell, cell + 1);
+
+            if (row + 1 < size && col > 0)
+                graph.connect(cell, cell + size - 1);
+
+            if (row + 1 < size)
+                graph.connect(cell, cell + size);
+        }
+    }
+
+    for (int i = 0; i < size; i++) {
+        graph.connect(border(Turn::Blue, false), i * size);
+        graph.connect(border(Turn::Blue, true), i * size + size - 1);
+        graph.connect(border(Turn::Red, false), i);
+        graph.connect(border(Turn::Red, true), (size - 1) * size + i);
+    }
+
+    // The adjacency never changes again
+    graph.compact();
+}
+
+int DistanceEvaluator::border(Turn player, bool end) const
+{
+    int node = size * size + (end ? 1 : 0);
+
+    return player == Turn::Blue ? node : node + 2;
+}
+
+void DistanceEvaluator::prepare(const Board& board, Turn player)
+{
+    int cells = size * size;
+
+    for (int cell = 0; cell < cells; cell++)
+        owners[cell] = board.get(cell / size, cell % size);
+
+    groups.reset();
+
+    // Groups touching a border have the border node as their root
+    for (int node = cells; node < cells + 4; node++)
+        liberties[node] = Bitboard(cells);
+
+    for (int cell = 0; cell < cells; cell++) {
+        if (owners[cell] != player)
+            continue;
+
+        liberties[cell] = Bitboard(cells);
+
+        graph.forEachEdgeFrom(cell, [this, player](const Edge& edge) {
+            if (edge.to >= size * size) {
+                if (edge.to == border(player, false) || edge.to == border(player, true))
+                    groups.unite(edge.from, edge.to);
+            } else if (owners[edge.to] == player) {
+                groups.unite(edge.from, edge.to);
+            }
+        });
+    }
+
+    // Liberties are gathered once groups are complete, on their roots
+    for (int cell = 0; cell < cells; cell++) {
+        if (owners[cell] != player)
+            continue;
+
+        int root = groups.find(cell);
+
+        graph.forEachEdgeFrom(cell, [this, root](const Edge& edge) {
+            if (edge.to < size * size && owners[edge.to] == Turn::Undecided)
+                liberties[root].set(edge.to);
+        });
+    }
+
+    for (int cell = 0; cell < cells; cell++) {
+        if (owners[cell] != Turn::Undecided)
+            continue;
+
+        Bitboard& neighbourhood = neighbourhoods[cell];
+        neighbourhood = Bitboard(cells);
+
+        graph.forEachEdgeFrom(cell, [this, player, &neighbourhood](const Edge& edge) {
+            if (edge.to >= size * size)
+                return;
+
+            if (owners[edge.to] == Turn::Undecided)
+                neighbourhood.set(edge.to);
+
+            if (owners[edge.to] == player)
+                neighbourhood = neighbourhood | liberties[groups.find(edge.to)];
+        });
+
+        neighbourhood.reset(cell);
+    }
+}
+
+void DistanceEvaluator::computeTwoDistances(int node, std::vector<int>& distances)
+{
+    int cells = size * size;
+
+    std::fill(distances.begin(), distances.end(), UNREACHABLE);
+
+    // Cells touching the border, directly or through a group, are at distance 1
+    for (int cell = 0; cell < cells; cell++) {
+        if (owners[cell] != Turn::Undecided)
+            continue;
+
+        graph.forEachEdgeFrom(cell, [this, node, cell, &distances](const Edge& edge) {
+            if (edge.to == node || (edge.to < size * size && owners[edge.to] != Turn::Undecided
+                    && groups.connected(edge.to, node)))
+                distances[cell] = 1;
+        });
+    }
+
+    // Distances only decrease, so sweeping until nothing changes converges
+    bool changed = true;
+
+    while (changed) {
+        changed = false;
+
+        for (int cell = 0; cell < cells; cell++) {
+            if (owners[cell] != Turn::Undecided || distances[cell] == 1)
+                continue;
+
+            int best = UNREACHABLE;
+            int second = UNREACHABLE;
+
+            neighbourhoods[cell].forEach([&distances, &best, &second](int neighbour) {
+                int distance = distances[neighbour];
+
+                if (distance < best) {
+                    second = best;
+                    best = distance;
+                } else if (distance < second) {
+                    second = distance;
+                }
+            });
+
+            if (second < UNREACHABLE && second + 1 < distances[cell]) {
+                distances[cell] = second + 1;
+                changed = true;
+            }
+        }
+    }
+}
+
+int DistanceEvaluator::countMissingStones(const Board& board, Turn player)
+{
+    int cells = size * size;
+
+    for (int cell = 0; cell < cells; cell++) {
+        Turn owner = board.get(cell / size, cell % size);
+
+        if (owner == player)
+            costs[cell] = 0;
+        else if (owner == Turn::Undecided)
+            costs[cell] = 1;
+        else
+            costs[cell] = BreadthFirstSearch::BLOCKED;
+    }
+
+    Turn opponent = player == Turn::Blue ? Turn::Red : Turn::Blue;
+
+    costs[border(player, false)] = 0;
+    costs[border(player, true)] = 0;
+    costs[border(opponent, false)] = BreadthFirstSearch::BLOCKED;
+    costs[border(opponent, true)] = BreadthFirstSearch::BLOCKED;
+
+    int cost = search.findCheapestCost(border(player, false), border(player, true), costs);
+
+    return cost == BreadthFirstSearch::UNREACHABLE ? UNREACHABLE : cost;
+}
+
+int DistanceEvaluator::getPotential(const Board& board, Turn player)
+{
+    prepare(board, player);
+
+    if (groups.connected(border(player, false), border(player, true)))
+        return 0;
+
+    computeTwoDistances(border(player, false), startDistances);
+    computeTwoDistances(border(player, true), endDistances);
+
+    int potential = UNREACHABLE;
+
+    for (int cell = 0; cell < size * size; cell++) {
+        if (owners[cell] != Turn::Undecided)
+            continue;
+
+        if (startDistances[cell] < UNREACHABLE && endDistances[cell] < UNREACHABLE)
+            potential = std::min(potential, startDistances[cell] + endDistances[cell]);
+    }
+
+    return potential;
+}
+
+int DistanceEvaluator::getCellPotential(const Board& board, Turn player, int row, int col)
+{
+    if (row < 0 || row >= size || col < 0 || col >= size)
+        throw std::out_of_range("Row or column index is out of range.");
+
+    prepare(board, player);
+
+    int cell = row * size + col;
+
+    if (owners[cell] != Turn::Undecided)
+        return UNREACHABLE;
+
+    computeTwoDistances(border(player, false), startDistances);
+    computeTwoDistances(border(player, true), endDistances);
+
+    if (startDistances[cell] == UNREACHABLE || endDistances[cell] == UNREACHABLE)
+        return UNREACHABLE;
+
+    return startDistances[cell] + endDistances[cell];
+}
+
+int DistanceEvaluator::evaluate(const Board& board, Turn player)
+{
+    Turn opponent = player == Turn::Blue ? Turn::Red : Turn::Blue;
+
+    return getPotential(board, opponent) - getPotential(board, player);
+}
@@ -0,0 +1,149 @@
+#ifndef DISTANCE_EVALUATOR_H
+#define DISTANCE_EVALUATOR_H
+
+#include <vector>
+#include "common.hpp"
+#include "graph.hpp"
+#include "bitboard.hpp"
+#include "union_find.hpp"
+#include "breadth_first_search.hpp"
+
+// Forward declarations
+class Board;
+
+/**
+ * The `DistanceEvaluator` class scores Hex positions statically, from how
+ * far each player is from connecting its borders.
+ *
+ * It works on a graph with the adjacency of the board cells plus four
+ * virtual nodes, one for each border, and provides two measures:
+ *
+ * - The number of stones a player still needs to connect its borders,
+ *   where own stones cost 0, empty cells cost 1 and enemy cells are blocked.
+ *
+ * - The two-distance potential, where the distance of a cell to a border
+ *   is one more than the second best distance of its neighbours, since the
+ *   opponent can always block the best one. Own stones are transparent.
+ *
+ * The evaluator keeps its buffers between calls, so it can't be copied.
+ */
+class DistanceEvaluator
+{
+private:
+    // The number of rows and also the number of columns
+    int size;
+
+    // Board adjacency plus the four border nodes
+    Graph graph;
+
+    // 0-1 search used to count missing stones
+    BreadthFirstSearch search;
+
+    // Groups of connected stones of the evaluated player, and its borders
+    UnionFind groups;
+
+    // Cost of each node for the 0-1 search
+    std::vector<int> costs;
+
+    // Color of each cell of the evaluated board
+    std::vector<Turn> owners;
+
+    // Empty cells next to each group, indexed by its root, which is
+    // a border node for groups that touch one
+    std::vector<Bitboard> liberties;
+
+    // Empty cells reachable from each empty cell in one move
+    std::vector<Bitboard> neighbourhoods;
+
+    // Two-distances to each of the player borders
+    std::vector<int> startDistances;
+    std::vector<int> endDistances;
+
+    /**
+     * Get the virtual node of one of the borders of a player.
+     *
+     * @param player The player whose border is requested.
+     * @param end Whether to get the second border (right or bottom).
+     *
+     * @return Node number.
+     */
+    int border(Turn player, bool end) const;
+
+    /**
+     * Read the cell owners of a board and group the stones of a player.
+     */
+    void prepare(const Board& board, Turn player);
+
+    /**
+     * Compute the two-distance of every empty cell to a border.
+     *
+     * @param node Virtual node of the border.
+     * @param distances Vector that will receive the distances.
+     */
+    void computeTwoDistances(int node, std::vector<int>& distances);
+
+public:
+    /**
+     * Value used for distances of players who can't connect anymore.
+     */
+    static constexpr int UNREACHABLE = 10000;
+
+    /**
+     * Constructor of the evaluator.
+     *
+     * @param size Size of the boards to be evaluated.
+     */
+    DistanceEvaluator(int size);
+
+    DistanceEvaluator(const DistanceEvaluator&) = delete;
+    DistanceEvaluator& operator=(const DistanceEvaluator&) = delete;
+
+    /**
+     * Count the stones a player needs to add to connect its borders.
+     *
+     * @param board Board to be evaluated.
+     * @param player The player whose distance is requested.
+     *
+     * @return Number of stones, or UNREACHABLE.
+     */
+    int countMissingStones(const Board& board, Turn player);
+
+    /**
+     * Get the two-distance potential of a player: the lowest sum of the
+     * two-distances of an empty cell to both borders.
+     *
+     * @param board Board to be evaluated.
+     * @param player The player whose potential is requested.
+     *
+     * @return Potential, 0 if the player already connected or
+     *         UNREACHABLE if it can't connect anymore.
+     */
+    int getPotential(const Board& board, Turn player);
+
+    /**
+     * Get the sum of the two-distances of an empty cell to both borders
+     * of a player.
+     *
+     * @param board Board to be evaluated.
+     * @param player The player whose distances are requested.
+     * @param row The row index of the cell.
+     * @param col The column index of the cell.
+     *
+     * @return Sum of the distances, or UNREACHABLE if the cell is taken
+     *         or can't reach one of the borders.
+     */
+    int getCellPotential(const Board& board, Turn player, int row, int col);
+
+    /**
+     * Score a position from the point of view of a player, as the
+     * difference between the potentials of both players.
+     *
+     * @param board Board to be evaluated.
+     * @param player The player whose point of view is used.
+     *
+     * @return Positive values when the position favors the player.
+     */
+    int evaluate(const Board& board, Turn player);
+};
+
+#endif // DISTANCE_EVALUATOR_H
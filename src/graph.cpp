@@ -9,7 +9,7 @@ void Graph::adjust()
     connections.reserve(edgeCapacity);
 }
 
-Graph::Graph(int nodes, int edgeCapacity) : nodes(nodes), edgeCapacity(edgeCapacity), limits(nodes, {-1, -1}) {
+Graph::Graph(int nodes, int edgeCapacity) : nodes(nodes), edgeCapacity(edgeCapacity), limits(nodes, {-1, -1}), targetMasks(nodes, 0), compacted(false) {
     connections.reserve(edgeCapacity);
 }
 
@@ -17,25 +17,29 @@ void Graph::connect(int from, int to, bool bidirectional)
 {
     adjust();
 
-    if (from < 0 || from > nodes) {
+    if (from < 0 || from >= nodes) {
         throw std::out_of_range(
             "Can't create the connection because the from is invalid"
         );
     }
 
-    if (to < 0 || to > nodes) {
+    if (to < 0 || to >= nodes) {
         throw std::out_of_range(
             "Can't create the connection because the target is invalid"
         );
     }
 
-    if (nodesAreConnected(from, to)) {
-        if (! bidirectional)
-            return;
+    if (! nodesAreConnected(from, to))
+        append(from, to);
 
-        if (nodesAreConnected(to, from))
-            return;
-    }
+    if (bidirectional && ! nodesAreConnected(to, from))
+        append(to, from);
+}
+
+void Graph::append(int from, int to)
+{
+    // The compact layout doesn't have room for new edges
+    compacted = false;
 
     connections.push_back({to, -1});
 
@@ -48,10 +52,7 @@ void Graph::connect(int from, int to, bool bidirectional)
     }
 
     limits[from].tail = edge;
-
-    if (bidirectional) {
-        connect(to, from, false);
-    }
+    targetMasks[from] |= uint64_t(1) << (to & 63);
 }
 
 void Graph::bidirectedConnect(int from, int to)
@@ -70,6 +71,22 @@ bool Graph::nodesAreConnected(int from, int to)
         return false;
     }
 
+    // Neighbours in board-like graphs are close to each other, so their
+    // bits rarely collide and a clear bit is a definitive answer
+    if (! ((targetMasks[from] >> (to & 63)) & 1)) {
+        return false;
+    }
+
+    if (compacted) {
+        for (int i = offsets[from]; i < offsets[from + 1]; ++i) {
+            if (targets[i] == to) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
     for (int i = limits[from].head; i != -1; i = connections[i].next) {
         if (connections[i].target == to) {
             return true;
@@ -79,26 +96,37 @@ bool Graph::nodesAreConnected(int from, int to)
     return false;
 }
 
-const int& Graph::countNodes() const
+void Graph::compact()
 {
-    return nodes;
+    offsets.resize(nodes + 1);
+    targets.resize(countEdges());
+
+    int position = 0;
+
+    for (int node = 0; node < nodes; ++node) {
+        offsets[node] = position;
+
+        for (int edge = limits[node].head; edge != -1; edge = connections[edge].next)
+            targets[position++] = connections[edge].target;
+    }
+
+    offsets[nodes] = position;
+    compacted = true;
 }
 
-const int Graph::countEdges() const
+bool Graph::isCompact() const
 {
-    return connections.size();
+    return compacted;
 }
 
-void Graph::forEachEdgeFrom(int node, std::function<void(const Edge&)> callback) const
+const int& Graph::countNodes() const
 {
-    for (int edge = limits[node].head; edge != -1; edge = connections[edge].next)
-        callback(Edge(node, connections[edge].target));
+    return nodes;
 }
 
-void Graph::forEachEdge(std::function<void(const Edge&)> callback) const
+const int Graph::countEdges() const
 {
-    for (int node = 0; node < nodes; ++node)
-        forEachEdgeFrom(node, callback);
+    return connections.size();
 }
 
 std::string Graph::toString() const
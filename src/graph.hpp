@@ -2,6 +2,7 @@
 #define GRAPH_H
 
 #include <vector>
+#include <cstdint>
 #include <stdexcept>
 #include <functional>
 #include <ostream>
@@ -46,6 +47,9 @@ struct NodeConnection
  *
  * Connections can be added but not removed.
  *
+ * Once a graph stops changing, it can be compacted into a compressed
+ * sparse row layout, where the targets of each node are contiguous in
+ * memory and traversals don't have to chase the `next` links.
  */
 class Graph {
 private:
@@ -61,10 +65,31 @@ private:
     // Edge targets and their next siblings
     std::vector<NodeConnection> connections;
 
+    // For each node, one bit per target modulo 64, so that most
+    // membership checks are answered without walking the edge list
+    std::vector<uint64_t> targetMasks;
+
+    // Whether the compact layout is up to date
+    bool compacted;
+
+    // Start of the targets of each node in the compact layout (plus an end marker)
+    std::vector<int> offsets;
+
+    // Targets of every node, stored contiguously in the compact layout
+    std::vector<int> targets;
+
     /**
      * If necessary, allocates more memory when connections are created.
      */
     void adjust();
+
+    /**
+     * Append a directed edge without checking if it already exists.
+     *
+     * @param from The source node of the connection.
+     * @param to The target node of the connection.
+     */
+    void append(int from, int to);
 public:
     /**
      * Constructor for the Graph class.
@@ -125,15 +150,46 @@ public:
      */
     const int countEdges() const;
 
+    /**
+     * Build the compact layout, which will be used by the traversals until
+     * a new connection is added.
+     */
+    void compact();
+
+    /**
+     * Check if the graph is using its compact layout.
+     *
+     * @return Whether the graph is compacted.
+     */
+    bool isCompact() const;
+
     /**
      * Iterate each of the edges of a given node calling a callback.
+     *
+     * The callback is a template parameter rather than a `std::function`
+     * so that the compiler can inline it in the search loops.
      */
-    void forEachEdgeFrom(int node, std::function<void(const Edge&)> callback) const;
+    template<typename Callback>
+    void forEachEdgeFrom(int node, Callback&& callback) const {
+        if (compacted) {
+            for (int i = offsets[node]; i < offsets[node + 1]; ++i)
+                callback(Edge(node, targets[i]));
+
+            return;
+        }
+
+        for (int edge = limits[node].head; edge != -1; edge = connections[edge].next)
+            callback(Edge(node, connections[edge].target));
+    }
 
     /**
      * Iterate each of the edges of the graph calling a callback.
      */
-    void forEachEdge(std::function<void(const Edge&)> callback) const;
+    template<typename Callback>
+    void forEachEdge(Callback&& callback) const {
+        for (int node = 0; node < nodes; ++node)
+            forEachEdgeFrom(node, callback);
+    }
 
     /**
      * Return the graph as a string.
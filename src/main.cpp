@@ -3,11 +3,16 @@
 #include <iostream>
 #include <ncurses.h>
 #include <cstring>
+#include <algorithm>
+#include <thread>
 #include "window.hpp"
 #include "dijkstra.hpp"
 #include "graph.hpp"
 #include "board.hpp"
 #include "strategy.hpp"
+#include "mcts.hpp"
+#include "resistance.hpp"
+#include "alpha_beta.hpp"
 
 HumanPlayers readArguments(int argc, char *argv[])
 {
@@ -27,18 +32,47 @@ HumanPlayers readArguments(int argc, char *argv[])
     return humanPlayers;
 }
 
+bool readFlag(int argc, char *argv[], const char* flag)
+{
+    for (int i = 0; i < argc; i++) {
+        if (strcmp(argv[i], flag) == 0)
+            return true;
+    }
+
+    return false;
+}
+
+std::unique_ptr<MoveStrategy> createStrategy(Turn player, bool mcts, bool resistance, bool alphaBeta, int threads)
+{
+    if (mcts)
+        return std::make_unique<MCTSStrategy>(player);
+
+    if (resistance)
+        return std::make_unique<ResistanceStrategy>(player);
+
+    if (alphaBeta)
+        return std::make_unique<AlphaBetaStrategy>(player);
+
+    return std::make_unique<AIStrategy>(player, 100, threads);
+}
+
 int main(int argc, char *argv[])
 {
     HumanPlayers humanPlayers = readArguments(argc, argv);
 
     Board board(BOARD_SIZE, humanPlayers);
+
+    int threads = std::max(1u, std::thread::hardware_concurrency());
+    bool mcts = readFlag(argc, argv, "--mcts");
+    bool resistance = readFlag(argc, argv, "--resistance");
+    bool alphaBeta = readFlag(argc, argv, "--alphabeta");
     
     if (!humanPlayers.blue) {
-        board.setStrategy(Turn::Blue, std::make_unique<AIStrategy>(Turn::Blue));
+        board.setStrategy(Turn::Blue, createStrategy(Turn::Blue, mcts, resistance, alphaBeta, threads));
     }
 
     if (!humanPlayers.red) {
-        board.setStrategy(Turn::Red, std::make_unique<AIStrategy>(Turn::Red));
+        board.setStrategy(Turn::Red, createStrategy(Turn::Red, mcts, resistance, alphaBeta, threads));
     }
     
     Window window(board);
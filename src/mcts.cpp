@@ -0,0 +1,153 @@
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include "mcts.hpp"
+#include "board.hpp"
+
+NodePool::NodePool(int capacity) : capacity(capacity)
+{
+    nodes.reserve(capacity);
+}
+
+int NodePool::allocate(int count)
+{
+    if (size() + count > capacity)
+        return -1;
+
+    int first = size();
+    nodes.resize(first + count);
+
+    return first;
+}
+
+void NodePool::clear()
+{
+    nodes.clear();
+}
+
+int NodePool::size() const
+{
+    return nodes.size();
+}
+
+MCTSStrategy::MCTSStrategy(Turn player, int iterationCount, double exploration, int nodeCapacity, uint64_t seed) :
+    player(player),
+    iterationCount(iterationCount),
+    exploration(exploration),
+    pool(nodeCapacity),
+    random(seed),
+    simulations(0)
+{}
+
+int MCTSStrategy::select(int node) const
+{
+    const MCTSNode& parent = pool[node];
+    double logVisits = std::log(parent.visits);
+
+    int best = parent.firstChild;
+    double bestValue = -std::numeric_limits<double>::infinity();
+
+    for (int child = parent.firstChild; child < parent.firstChild + parent.childCount; child++) {
+        const MCTSNode& candidate = pool[child];
+
+        // Unvisited children are always tried first
+        if (candidate.visits == 0)
+            return child;
+
+        double value = (double) candidate.wins / candidate.visits
+            + exploration * std::sqrt(logVisits / candidate.visits);
+
+        if (value > bestValue) {
+            bestValue = value;
+            best = child;
+        }
+    }
+
+    return best;
+}
+
+bool MCTSStrategy::expand(int node, const Board& board)
+{
+    Bitboard empty = board.getOccupied().complement();
+    int first = pool.allocate(empty.count());
+
+    if (first == -1)
+        return false;
+
+    int child = first;
+
+    empty.forEach([this, &child, node, &board](int cell) {
+        pool[child++] = {cell, board.current(), node, -1, 0, 0, 0};
+    });
+
+    pool[node].firstChild = first;
+    pool[node].childCount = child - first;
+
+    return true;
+}
+
+void MCTSStrategy::backpropagate(int node, Turn winner)
+{
+    for (; node != -1; node = pool[node].parent) {
+        pool[node].visits++;
+
+        if (pool[node].mover == winner)
+            pool[node].wins++;
+    }
+}
+
+Position MCTSStrategy::getNextMove(const Board& board)
+{
+    int size = board.getSize();
+    Turn opponent = player == Turn::Blue ? Turn::Red : Turn::Blue;
+
+    pool.clear();
+
+    int root = pool.allocate(1);
+    pool[root] = {-1, opponent, -1, -1, 0, 0, 0};
+
+    if (! expand(root, board) || pool[root].childCount == 0)
+        throw std::runtime_error("There are no moves to search");
+
+    Board simulation = board;
+
+    for (int i = 0; i < iterationCount; i++) {
+        simulation = board;
+        int node = root;
+
+        // Selection: descend while the nodes are expanded
+        while (pool[node].childCount > 0) {
+            node = select(node);
+            simulation.set(pool[node].cell / size, pool[node].cell % size, false);
+        }
+
+        // Expansion: grow the tree by one level under the leaf
+        if (pool[node].visits > 0) {
+            if (simulation.getOccupied().count() < size * size && expand(node, simulation)) {
+                node = select(node);
+                simulation.set(pool[node].cell / size, pool[node].cell % size, false);
+            }
+        }
+
+        // Rollout: fill the board randomly, which always decides a winner
+        backpropagate(node, playout.run(simulation, random));
+    }
+
+    simulations += iterationCount;
+
+    // The most visited move is the most robust choice
+    const MCTSNode& rootNode = pool[root];
+    int best = rootNode.firstChild;
+
+    for (int child = rootNode.firstChild; child < rootNode.firstChild + rootNode.childCount; child++) {
+        if (pool[child].visits > pool[best].visits)
+            best = child;
+    }
+
+    return Position({pool[best].cell / size, pool[best].cell % size});
+}
+
+long long MCTSStrategy::countSimulations() const
+{
+    return simulations;
+}
@@ -0,0 +1,146 @@
+#ifndef MCTS_H
+#define MCTS_H
+
+#include <vector>
+#include "common.hpp"
+#include "strategy.hpp"
+#include "playout.hpp"
+
+/**
+ * The `MCTSNode` struct stores a position of the search tree, identified
+ * by the move that leads to it from its parent.
+ *
+ * Children of a node are stored contiguously in the node pool, so a node
+ * only needs to know where its first child is and how many there are.
+ */
+struct MCTSNode
+{
+    int cell;
+    Turn mover;
+    int parent;
+    int firstChild;
+    int childCount;
+    int visits;
+    int wins;
+};
+
+/**
+ * The `NodePool` class preallocates the nodes of a search tree so that
+ * growing the tree never reaches the heap. Nodes are released all at once.
+ */
+class NodePool
+{
+private:
+    // Maximum number of nodes that can be allocated
+    int capacity;
+
+    // Storage of the nodes, reserved on construction
+    std::vector<MCTSNode> nodes;
+
+public:
+    /**
+     * Constructor of the node pool.
+     *
+     * @param capacity Maximum number of nodes.
+     */
+    NodePool(int capacity);
+
+    /**
+     * Allocate a contiguous block of nodes.
+     *
+     * @param count Number of nodes.
+     *
+     * @return Index of the first node, or -1 if the pool is exhausted.
+     */
+    int allocate(int count);
+
+    /**
+     * Release every node of the pool.
+     */
+    void clear();
+
+    /**
+     * Get the number of allocated nodes.
+     *
+     * @return Number of nodes.
+     */
+    int size() const;
+
+    MCTSNode& operator[](int index) {
+        return nodes[index];
+    }
+
+    const MCTSNode& operator[](int index) const {
+        return nodes[index];
+    }
+};
+
+/**
+ * Move strategy based on a Monte Carlo Tree Search with UCT selection.
+ */
+class MCTSStrategy : public MoveStrategy {
+private:
+    Turn player;
+    int iterationCount;
+    double exploration;
+    NodePool pool;
+    Playout playout;
+    Random random;
+    long long simulations;
+
+    /**
+     * Choose the child of a node with the best upper confidence bound.
+     *
+     * @param node Index of the parent node.
+     *
+     * @return Index of the selected child.
+     */
+    int select(int node) const;
+
+    /**
+     * Create one child per empty cell of the board.
+     *
+     * @param node Index of the node to be expanded.
+     * @param board Board in the position of the node.
+     *
+     * @return Whether the node could be expanded.
+     */
+    bool expand(int node, const Board& board);
+
+    /**
+     * Update the statistics of a node and its ancestors.
+     *
+     * @param node Index of the last node of the iteration.
+     * @param winner Color of the player who won the rollout.
+     */
+    void backpropagate(int node, Turn winner);
+
+public:
+    /**
+     * Create a tree search strategy for a specific player
+     *
+     * @param player The player color (Blue or Red)
+     * @param iterationCount Number of search iterations per move (default: 1000)
+     * @param exploration Weight of the exploration term of UCT (default: 1.4)
+     * @param nodeCapacity Maximum number of nodes of the tree (default: 262144)
+     * @param seed Seed that makes the moves reproducible (default: taken from the system)
+     */
+    MCTSStrategy(Turn player, int iterationCount = 1000, double exploration = 1.4, int nodeCapacity = 1 << 18, uint64_t seed = Random::systemSeed());
+
+    /**
+     * Calculate the next move using a tree search
+     *
+     * @param board Current game board state
+     * @return Position The best position found for the next move
+     */
+    Position getNextMove(const Board& board) override;
+
+    /**
+     * Get the number of search iterations run in all the calls to getNextMove
+     *
+     * @return Number of simulations
+     */
+    long long countSimulations() const override;
+};
+
+#endif // MCTS_H
@@ -0,0 +1,161 @@
+#include <utility>
+#include "playout.hpp"
+#include "board.hpp"
+
+Playout::Playout(bool answerBridges) : answerBridges(answerBridges), size(0) {}
+
+void Playout::buildBridges()
+{
+    const int offsets[6][2] = {{-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}};
+
+    bridges.assign(size * size * 6, {-1, -1, -1});
+    bridgeCounts.assign(size * size, 0);
+
+    auto inside = [this](int row, int col) {
+        return row >= 0 && row < size && col >= 0 && col < size;
+    };
+
+    auto adjacent = [](int row, int col, int r, int c) {
+        int dr = r - row, dc = c - col;
+        return (dr == -1 && (dc == 0 || dc == 1)) || (dr == 0 && (dc == -1 || dc == 1))
+            || (dr == 1 && (dc == -1 || dc == 0));
+    };
+
+    // Two adjacent cells are the carrier of a bridge between
+    // the two cells that are next to both of them
+    for (int cell = 0; cell < size * size; ++cell) {
+        int row = cell / size, col = cell % size;
+
+        for (const auto& offset : offsets) {
+            int r = row + offset[0], c = col + offset[1];
+
+            if (! inside(r, c))
+                continue;
+
+            int ends[2];
+            int count = 0;
+
+            for (const auto& other : offsets) {
+                int er = row + other[0], ec = col + other[1];
+
+                if (inside(er, ec) && ! (er == r && ec == c) && adjacent(r, c, er, ec))
+                    ends[count++] = er * size + ec;
+            }
+
+            if (count == 2)
+                bridges[cell * 6 + bridgeCounts[cell]++] = {r * size + c, ends[0], ends[1]};
+        }
+    }
+}
+
+int Playout::findBridgeReply(int cell, Turn owner) const
+{
+    for (int i = 0; i < bridgeCounts[cell]; ++i) {
+        const Bridge& bridge = bridges[cell * 6 + i];
+
+        if (cells[bridge.carrier] == Turn::Undecided && cells[bridge.first] == owner && cells[bridge.second] == owner)
+            return bridge.carrier;
+    }
+
+    return -1;
+}
+
+Turn Playout::run(const Board& board, Random& random)
+{
+    int previousSize = size;
+    size = board.getSize();
+
+    if (answerBridges && size != previousSize)
+        buildBridges();
+
+    cells.assign(size * size, Turn::Undecided);
+
+    board.getPieces(Turn::Blue).forEach([this](int cell) {
+        cells[cell] = Turn::Blue;
+    });
+
+    board.getPieces(Turn::Red).forEach([this](int cell) {
+        cells[cell] = Turn::Red;
+    });
+
+    board.getEmptyCells().permutation(random, empty);
+
+    // Finished games have no current player, but a full board needs
+    // both colors anyway, so any of them can start
+    Turn turn = board.current() == Turn::Red ? Turn::Red : Turn::Blue;
+    Turn other = turn == Turn::Blue ? Turn::Red : Turn::Blue;
+
+    if (! answerBridges) {
+        for (size_t i = 0; i < empty.size(); ++i)
+            cells[empty[i]] = (i % 2 == 0) ? turn : other;
+
+        return blueConnects() ? Turn::Blue : Turn::Red;
+    }
+
+    // Moves are taken from the shuffled cells, skipping those
+    // that were already used to answer an intrusion
+    size_t next = 0;
+    int last = -1;
+
+    for (size_t i = 0; i < empty.size(); ++i) {
+        int cell = last == -1 ? -1 : findBridgeReply(last, turn);
+
+        if (cell == -1) {
+            while (cells[empty[next]] != Turn::Undecided)
+                ++next;
+
+            cell = empty[next++];
+        }
+
+        cells[cell] = turn;
+        last = cell;
+        std::swap(turn, other);
+    }
+
+    return blueConnects() ? Turn::Blue : Turn::Red;
+}
+
+bool Playout::blueConnects()
+{
+    const int offsets[6][2] = {{-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}};
+
+    reached.assign(size * size, false);
+    stack.clear();
+
+    for (int row = 0; row < size; ++row) {
+        int cell = row * size;
+
+        if (cells[cell] == Turn::Blue) {
+            reached[cell] = true;
+            stack.push_back(cell);
+        }
+    }
+
+    while (! stack.empty()) {
+        int cell = stack.back();
+        stack.pop_back();
+
+        int row = cell / size;
+        int col = cell % size;
+
+        if (col == size - 1)
+            return true;
+
+        for (const auto& offset : offsets) {
+            int r = row + offset[0];
+            int c = col + offset[1];
+
+            if (r < 0 || r >= size || c < 0 || c >= size)
+                continue;
+
+            int neighbour = r * size + c;
+
+            if (cells[neighbour] == Turn::Blue && ! reached[neighbour]) {
+                reached[neighbour] = true;
+                stack.push_back(neighbour);
+            }
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,112 @@
+#ifndef PLAYOUT_H
+#define PLAYOUT_H
+
+#include <vector>
+#include "common.hpp"
+#include "random.hpp"
+
+// Forward declarations
+class Board;
+
+/**
+ * The `Playout` class finishes a game by filling every empty cell of a
+ * board at random, alternating colors, and decides its winner.
+ *
+ * A filled Hex board always has exactly one winner, so instead of playing
+ * each move through `Board::set` the cells are written into a flat array
+ * and the winner is found with a single flood fill at the end.
+ *
+ * Optionally, the playout can answer bridge intrusions: when a player
+ * moves into one of the two cells that join two stones of its opponent,
+ * the opponent replies in the other one. Bridges are looked up in a table
+ * with the bridges each cell belongs to, built once per board size.
+ */
+class Playout
+{
+private:
+    /**
+     * A bridge seen from one of its carrier cells: the other carrier
+     * and the two cells it joins.
+     */
+    struct Bridge {
+        int carrier, first, second;
+    };
+
+    // Whether bridge intrusions are answered
+    bool answerBridges;
+
+    // The size of the last board that was played out
+    int size;
+
+    // Bridges of each cell, with room for six per cell
+    std::vector<Bridge> bridges;
+
+    // Number of bridges of each cell
+    std::vector<int> bridgeCounts;
+
+    // The color of each cell, numbered as in `Board::cell`
+    std::vector<Turn> cells;
+
+    // The cells that were empty when the playout started
+    std::vector<int> empty;
+
+    // Pending cells of the flood fill
+    std::vector<int> stack;
+
+    // Cells already reached by the flood fill
+    std::vector<bool> reached;
+
+    /**
+     * Check if blue connects its left and right borders.
+     *
+     * @return Whether the blue player won.
+     */
+    bool blueConnects();
+
+    /**
+     * Fill the bridge tables for the current size.
+     */
+    void buildBridges();
+
+    /**
+     * Look for the reply to a move that breaks into a bridge.
+     *
+     * @param cell Cell of the move.
+     * @param owner Color of the player who may reply.
+     *
+     * @return Cell that saves the bridge, or -1 if there's none.
+     */
+    int findBridgeReply(int cell, Turn owner) const;
+
+public:
+    /**
+     * Create a playout object.
+     *
+     * @param answerBridges Whether bridge intrusions are answered (default: false).
+     */
+    Playout(bool answerBridges = false);
+
+    /**
+     * Fill the empty cells of a board randomly, starting with the player
+     * whose turn it is, and find who won.
+     *
+     * @param board Board whose position will be completed.
+     * @param random Generator used to shuffle the empty cells.
+     *
+     * @return Color of the player who won the filled board.
+     */
+    Turn run(const Board& board, Random& random);
+
+    /**
+     * Get the color of a cell after the last playout.
+     *
+     * @param cell Cell number, as returned by `Board::cell`.
+     *
+     * @return Color of the cell.
+     */
+    const Turn& operator[](int cell) const {
+        return cells[cell];
+    }
+};
+
+#endif // PLAYOUT_H
@@ -0,0 +1,112 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+#include <limits>
+#include <random>
+
+/**
+ * The `Random` class is a fast, seedable xoshiro256** generator.
+ *
+ * It meets the requirements of a uniform random bit generator, so it
+ * can be used with `std::shuffle` and the standard distributions. It
+ * isn't meant to be shared between threads: each thread or simulation
+ * worker should own its own instance.
+ */
+class Random
+{
+private:
+    uint64_t state[4];
+
+    static uint64_t rotate(uint64_t value, int bits) {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+public:
+    typedef uint64_t result_type;
+
+    /**
+     * Create a generator whose sequence is fully determined by a seed.
+     *
+     * @param seed Any 64 bit value, zero included.
+     */
+    explicit Random(uint64_t seed) {
+        // Expand the seed with splitmix64, as recommended by the authors
+        for (int i = 0; i < 4; ++i) {
+            seed += 0x9e3779b97f4a7c15;
+
+            uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+            state[i] = z ^ (z >> 31);
+        }
+    }
+
+    /**
+     * Get a seed from the system entropy source.
+     *
+     * It's slow, so it should only be used to seed long lived generators.
+     *
+     * @return Seed value.
+     */
+    static uint64_t systemSeed() {
+        std::random_device device;
+
+        return (uint64_t(device()) << 32) ^ device();
+    }
+
+    static constexpr result_type min() {
+        return 0;
+    }
+
+    static constexpr result_type max() {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()() {
+        uint64_t result = rotate(state[1] * 5, 7) * 9;
+        uint64_t t = state[1] << 17;
+
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotate(state[3], 45);
+
+        return result;
+    }
+
+    /**
+     * Get a number in the range from 0 to bound - 1.
+     *
+     * @param bound Exclusive upper limit, from 1 to 2^32 - 1.
+     *
+     * @return Random number.
+     */
+    uint32_t below(uint32_t bound) {
+        return ((operator()() >> 32) * bound) >> 32;
+    }
+
+    /**
+     * Get a random boolean value.
+     */
+    bool flipCoin() {
+        return operator()() >> 63;
+    }
+};
+
+/**
+ * Get a generator owned by the calling thread and seeded from the system,
+ * for the places where no generator is passed explicitly.
+ *
+ * @return Generator of the calling thread.
+ */
+inline Random& threadRandom()
+{
+    thread_local Random random(Random::systemSeed());
+
+    return random;
+}
+
+#endif // RANDOM_H
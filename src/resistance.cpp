@@ -0,0 +1,358 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include "resistance.hpp"
+#include "board.hpp"
+
+ResistanceEvaluator::ResistanceEvaluator(int size) :
+    size(size),
+    groups(size*size + 2),
+    nodes(size*size),
+    blueVoltages(size*size, 0.5),
+    redVoltages(size*size, 0.5),
+    iterations(0)
+{}
+
+int ResistanceEvaluator::getSize() const
+{
+    return size;
+}
+
+int ResistanceEvaluator::build(const Board& board, Turn player)
+{
+    const int offsets[6][2] = {{-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}};
+    int cells = size * size;
+    int start = cells;
+    int end = cells + 1;
+
+    // Cells touching each border of the player
+    auto onStart = [player](int row, int col) {
+        return player == Turn::Blue ? col == 0 : row == 0;
+    };
+    auto onEnd = [this, player](int row, int col) {
+        return player == Turn::Blue ? col == size - 1 : row == size - 1;
+    };
+
+    groups.reset();
+
+    for (int cell = 0; cell < cells; cell++) {
+        int row = cell / size, col = cell % size;
+
+        if (board.get(row, col) != player)
+            continue;
+
+        if (onStart(row, col))
+            groups.unite(cell, start);
+
+        if (onEnd(row, col))
+            groups.unite(cell, end);
+
+        for (const auto& offset : offsets) {
+            int r = row + offset[0], c = col + offset[1];
+
+            if (r >= 0 && r < size && c >= 0 && c < size && board.get(r, c) == player)
+                groups.unite(cell, r * size + c);
+        }
+    }
+
+    if (groups.connected(start, end))
+        return -1;
+
+    // Number the unknowns, starting from the voltages of the last solve
+    std::vector<double>& voltages = player == Turn::Blue ? blueVoltages : redVoltages;
+    roots.assign(cells, NONE);
+    solution.clear();
+
+    for (int cell = 0; cell < cells; cell++) {
+        Turn owner = board.get(cell / size, cell % size);
+
+        if (owner == Turn::Undecided) {
+            nodes[cell] = solution.size();
+            solution.push_back(voltages[cell]);
+        } else if (owner != player) {
+            nodes[cell] = NONE;
+        } else if (groups.connected(cell, start)) {
+            nodes[cell] = START;
+        } else if (groups.connected(cell, end)) {
+            nodes[cell] = END;
+        } else {
+            int root = groups.find(cell);
+
+            if (roots[root] == NONE) {
+                roots[root] = solution.size();
+                solution.push_back(voltages[cell]);
+            }
+
+            nodes[cell] = roots[root];
+        }
+    }
+
+    int unknowns = solution.size();
+
+    diagonal.assign(unknowns, 0.0);
+    rightSide.assign(unknowns, 0.0);
+    startConductances.assign(unknowns, 0.0);
+    endConductances.assign(unknowns, 0.0);
+    entries.clear();
+
+    auto resistance = [&board](int row, int col) {
+        return board.get(row, col) == Turn::Undecided ? 1.0 : 0.0;
+    };
+
+    auto join = [this](int node, int other, double conductance) {
+        diagonal[node] += conductance;
+
+        if (other == START) {
+            startConductances[node] += conductance;
+            rightSide[node] += conductance;
+        } else if (other == END) {
+            endConductances[node] += conductance;
+        } else {
+            entries.push_back({node, other, -conductance});
+        }
+    };
+
+    for (int cell = 0; cell < cells; cell++) {
+        int node = nodes[cell];
+
+        if (node < 0)
+            continue;
+
+        int row = cell / size, col = cell % size;
+        double own = resistance(row, col);
+
+        // Borders have no resistance, so only the cell counts
+        if (onStart(row, col))
+            join(node, START, 1.0 / own);
+
+        if (onEnd(row, col))
+            join(node, END, 1.0 / own);
+
+        for (const auto& offset : offsets) {
+            int r = row + offset[0], c = col + offset[1];
+
+            if (r < 0 || r >= size || c < 0 || c >= size)
+                continue;
+
+            int other = nodes[r * size + c];
+
+            if (other == NONE || other == node)
+                continue;
+
+            join(node, other, 1.0 / (own + resistance(r, c)));
+        }
+    }
+
+    // Merge parallel conductances into compressed rows
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.row < b.row || (a.row == b.row && a.column < b.column);
+    });
+
+    rowStarts.assign(unknowns + 1, 0);
+    columns.clear();
+    values.clear();
+
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (i > 0 && entries[i].row == entries[i - 1].row && entries[i].column == entries[i - 1].column) {
+            values.back() += entries[i].value;
+            continue;
+        }
+
+        columns.push_back(entries[i].column);
+        values.push_back(entries[i].value);
+        rowStarts[entries[i].row + 1]++;
+    }
+
+    for (int i = 0; i < unknowns; i++)
+        rowStarts[i + 1] += rowStarts[i];
+
+    return unknowns;
+}
+
+bool ResistanceEvaluator::restrict(int unknowns)
+{
+    reached.assign(unknowns, 0);
+    queue.clear();
+
+    for (int node = 0; node < unknowns; node++) {
+        if (startConductances[node] > 0) {
+            reached[node] = 1;
+            queue.push_back(node);
+        }
+    }
+
+    for (size_t i = 0; i < queue.size(); i++) {
+        for (int k = rowStarts[queue[i]]; k < rowStarts[queue[i] + 1]; k++) {
+            if (! reached[columns[k]]) {
+                reached[columns[k]] = 1;
+                queue.push_back(columns[k]);
+            }
+        }
+    }
+
+    bool connects = false;
+
+    for (int node = 0; node < unknowns; node++) {
+        if (reached[node]) {
+            connects = connects || endConductances[node] > 0;
+            continue;
+        }
+
+        // Unknowns out of the circuit don't carry current
+        for (int k = rowStarts[node]; k < rowStarts[node + 1]; k++)
+            values[k] = 0.0;
+
+        diagonal[node] = 1.0;
+        rightSide[node] = 0.0;
+        solution[node] = 0.0;
+    }
+
+    return connects;
+}
+
+void ResistanceEvaluator::solve(int unknowns)
+{
+    auto multiply = [this, unknowns](const std::vector<double>& vector, std::vector<double>& result) {
+        for (int i = 0; i < unknowns; i++) {
+            double sum = diagonal[i] * vector[i];
+
+            for (int k = rowStarts[i]; k < rowStarts[i + 1]; k++)
+                sum += values[k] * vector[columns[k]];
+
+            result[i] = sum;
+        }
+    };
+
+    auto dot = [unknowns](const std::vector<double>& a, const std::vector<double>& b) {
+        double sum = 0.0;
+
+        for (int i = 0; i < unknowns; i++)
+            sum += a[i] * b[i];
+
+        return sum;
+    };
+
+    residual.resize(unknowns);
+    direction.resize(unknowns);
+    preconditioned.resize(unknowns);
+    product.resize(unknowns);
+
+    multiply(solution, product);
+
+    for (int i = 0; i < unknowns; i++) {
+        residual[i] = rightSide[i] - product[i];
+        preconditioned[i] = residual[i] / diagonal[i];
+        direction[i] = preconditioned[i];
+    }
+
+    double tolerance = 1e-12 * std::max(1.0, dot(rightSide, rightSide));
+    double rho = dot(residual, preconditioned);
+
+    for (int iteration = 0; iteration < 2 * unknowns + 10; iteration++) {
+        if (dot(residual, residual) <= tolerance)
+            break;
+
+        iterations++;
+        multiply(direction, product);
+
+        double alpha = rho / dot(direction, product);
+
+        for (int i = 0; i < unknowns; i++) {
+            solution[i] += alpha * direction[i];
+            residual[i] -= alpha * product[i];
+            preconditioned[i] = residual[i] / diagonal[i];
+        }
+
+        double next = dot(residual, preconditioned);
+        double beta = next / rho;
+        rho = next;
+
+        for (int i = 0; i < unknowns; i++)
+            direction[i] = preconditioned[i] + beta * direction[i];
+    }
+}
+
+double ResistanceEvaluator::getResistance(const Board& board, Turn player)
+{
+    if (board.getSize() != size)
+        throw std::invalid_argument("The board size doesn't match the evaluator.");
+
+    int unknowns = build(board, player);
+
+    if (unknowns == -1)
+        return 0.0;
+
+    if (! restrict(unknowns))
+        return std::numeric_limits<double>::infinity();
+
+    solve(unknowns);
+
+    // Keep the voltages as the starting point of the next solve
+    std::vector<double>& voltages = player == Turn::Blue ? blueVoltages : redVoltages;
+
+    for (int cell = 0; cell < size * size; cell++) {
+        if (nodes[cell] >= 0)
+            voltages[cell] = solution[nodes[cell]];
+    }
+
+    double current = 0.0;
+
+    for (int node = 0; node < unknowns; node++)
+        current += startConductances[node] * (1.0 - solution[node]);
+
+    return current > 0 ? 1.0 / current : std::numeric_limits<double>::infinity();
+}
+
+double ResistanceEvaluator::evaluate(const Board& board, Turn player)
+{
+    Turn opponent = player == Turn::Blue ? Turn::Red : Turn::Blue;
+
+    auto clamp = [](double resistance) {
+        return std::min(MAX_RESISTANCE, std::max(MIN_RESISTANCE, resistance));
+    };
+
+    return std::log(clamp(getResistance(board, opponent)) / clamp(getResistance(board, player)));
+}
+
+long long ResistanceEvaluator::countIterations() const
+{
+    return iterations;
+}
+
+ResistanceStrategy::ResistanceStrategy(Turn player, uint64_t seed) :
+    player(player),
+    random(seed)
+{}
+
+Position ResistanceStrategy::getNextMove(const Board& board)
+{
+    int size = board.getSize();
+
+    if (! evaluator || evaluator->getSize() != size)
+        evaluator = std::make_unique<ResistanceEvaluator>(size);
+
+    Bitboard empty = board.getOccupied().complement();
+
+    if (! empty.any())
+        throw std::runtime_error("There are no moves to evaluate");
+
+    Board simulation = board;
+    double bestScore = -std::numeric_limits<double>::infinity();
+    int bestCell = -1;
+
+    empty.forEach([this, &board, &simulation, &bestScore, &bestCell, size](int cell) {
+        simulation = board;
+        simulation.set(cell / size, cell % size, false);
+
+        double score = evaluator->evaluate(simulation, player);
+
+        if (score < bestScore || (score == bestScore && random.flipCoin()))
+            return;
+
+        bestScore = score;
+        bestCell = cell;
+    });
+
+    return Position({bestCell / size, bestCell % size});
+}
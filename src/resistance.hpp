@@ -0,0 +1,180 @@
+#ifndef RESISTANCE_H
+#define RESISTANCE_H
+
+#include <memory>
+#include <vector>
+#include "common.hpp"
+#include "strategy.hpp"
+#include "union_find.hpp"
+
+// Forward declarations
+class Board;
+
+/**
+ * The `ResistanceEvaluator` class scores Hex positions by modelling the
+ * board as an electrical circuit between the two borders of a player.
+ *
+ * Every cell is a resistor: own stones have no resistance, empty cells
+ * have a resistance of 1 and enemy stones cut the circuit. Adjacent cells
+ * are joined by a conductance of 1 / (r1 + r2). Own groups and the cells
+ * merged with a border collapse into single nodes.
+ *
+ * The voltages of the circuit are found by solving the resulting sparse
+ * linear system with a Jacobi preconditioned conjugate gradient. The last
+ * voltages of each player are kept as the starting point of the next
+ * solve, since consecutive positions only differ in a few stones.
+ */
+class ResistanceEvaluator
+{
+private:
+    // The number of rows and also the number of columns
+    int size;
+
+    // Groups of stones of the evaluated player, and its borders
+    UnionFind groups;
+
+    // Unknown of each cell, or one of the special values below
+    std::vector<int> nodes;
+
+    // Sparse system in compressed rows (off diagonal entries only)
+    std::vector<int> rowStarts;
+    std::vector<int> columns;
+    std::vector<double> values;
+    std::vector<double> diagonal;
+    std::vector<double> rightSide;
+
+    // Conductance of each unknown to each border
+    std::vector<double> startConductances;
+    std::vector<double> endConductances;
+
+    // Entries of the system before being merged in rows
+    struct Entry {
+        int row, column;
+        double value;
+    };
+    std::vector<Entry> entries;
+
+    // Unknown of each group, indexed by its root
+    std::vector<int> roots;
+
+    // Unknowns reached from the start border
+    std::vector<int> queue;
+    std::vector<char> reached;
+
+    // Work vectors of the solver
+    std::vector<double> solution;
+    std::vector<double> residual;
+    std::vector<double> direction;
+    std::vector<double> preconditioned;
+    std::vector<double> product;
+
+    // Voltage of every cell in the last solve of each player
+    std::vector<double> blueVoltages;
+    std::vector<double> redVoltages;
+
+    // Total number of iterations of the solver
+    long long iterations;
+
+    static constexpr int NONE = -1;
+    static constexpr int START = -2;
+    static constexpr int END = -3;
+
+    /**
+     * Build the system of a player from a board.
+     *
+     * @return Number of unknowns, or -1 if the player already connected.
+     */
+    int build(const Board& board, Turn player);
+
+    /**
+     * Mark the unknowns with no path to the start border as fixed, so that
+     * the system stays positive definite.
+     *
+     * @return Whether the start border can reach the end border.
+     */
+    bool restrict(int unknowns);
+
+    /**
+     * Solve the system starting from the current solution.
+     */
+    void solve(int unknowns);
+
+public:
+    /**
+     * Resistances are clamped to this range when positions are compared.
+     */
+    static constexpr double MIN_RESISTANCE = 1e-3;
+    static constexpr double MAX_RESISTANCE = 1e6;
+
+    /**
+     * Constructor of the evaluator.
+     *
+     * @param size Size of the boards to be evaluated.
+     */
+    ResistanceEvaluator(int size);
+
+    /**
+     * Get the size of the boards the evaluator works with.
+     *
+     * @return Number of rows (and columns).
+     */
+    int getSize() const;
+
+    /**
+     * Get the resistance between the borders of a player.
+     *
+     * @param board Board to be evaluated.
+     * @param player The player whose circuit is evaluated.
+     *
+     * @return Resistance, 0 if the player already connected or
+     *         infinity if it can't connect anymore.
+     */
+    double getResistance(const Board& board, Turn player);
+
+    /**
+     * Score a position from the point of view of a player, as the
+     * logarithm of the ratio between both resistances.
+     *
+     * @param board Board to be evaluated.
+     * @param player The player whose point of view is used.
+     *
+     * @return Positive values when the position favors the player.
+     */
+    double evaluate(const Board& board, Turn player);
+
+    /**
+     * Get the number of solver iterations run so far.
+     *
+     * @return Number of iterations.
+     */
+    long long countIterations() const;
+};
+
+/**
+ * Move strategy that plays the move with the best resistance evaluation.
+ */
+class ResistanceStrategy : public MoveStrategy {
+private:
+    Turn player;
+    Random random;
+    std::unique_ptr<ResistanceEvaluator> evaluator;
+
+public:
+    /**
+     * Create a resistance strategy for a specific player
+     *
+     * @param player The player color (Blue or Red)
+     * @param seed Seed used to break ties (default: taken from the system)
+     */
+    ResistanceStrategy(Turn player, uint64_t seed = Random::systemSeed());
+
+    /**
+     * Calculate the next move by evaluating every empty cell
+     *
+     * @param board Current game board state
+     * @return Position The best position found for the next move
+     */
+    Position getNextMove(const Board& board) override;
+};
+
+#endif // RESISTANCE_H
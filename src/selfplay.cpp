@@ -0,0 +1,286 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "board.hpp"
+#include "strategy.hpp"
+#include "mcts.hpp"
+#include "resistance.hpp"
+#include "alpha_beta.hpp"
+
+/**
+ * The `SelfPlayOptions` struct contains the parameters of a batch of games.
+ *
+ * The two sides are named after the color they play in the first game.
+ * When colors are swapped, the red side plays blue in every second game.
+ */
+struct SelfPlayOptions
+{
+    int games;
+    int size;
+    int simulations;
+    int budget;
+    int threads;
+    uint64_t seed;
+    bool swap;
+    std::string blue;
+    std::string red;
+    int blueSimulations;
+    int redSimulations;
+    int blueBudget;
+    int redBudget;
+};
+
+/**
+ * The `GameResult` struct contains the outcome of a single game, with
+ * the statistics of each side (blue side first).
+ */
+struct GameResult
+{
+    Turn winner;
+    bool swapped;
+    int moves[2];
+    double moveSeconds[2];
+    long long simulations;
+};
+
+void printUsage()
+{
+    std::cerr
+        << "Usage: hex-selfplay [options]" << std::endl
+        << "  --games N              Number of games to play (default: 10)" << std::endl
+        << "  --size N               Size of the board (default: 11)" << std::endl
+        << "  --blue NAME            Strategy of the blue side, `ai`, `bridges`, `amaf`, `anytime`, `mcts`, `resistance` or `alphabeta` (default: ai)" << std::endl
+        << "  --red NAME             Strategy of the red side, with the same choices (default: ai)" << std::endl
+        << "  --simulations N        Simulations or iterations per move (default: 100)" << std::endl
+        << "  --blue-simulations N   Simulations or iterations per move of the blue side (default: --simulations)" << std::endl
+        << "  --red-simulations N    Simulations or iterations per move of the red side (default: --simulations)" << std::endl
+        << "  --budget N             Milliseconds per move of `anytime` and `alphabeta` (default: 1000)" << std::endl
+        << "  --blue-budget N        Milliseconds per move of the blue side (default: --budget)" << std::endl
+        << "  --red-budget N         Milliseconds per move of the red side (default: --budget)" << std::endl
+        << "  --swap N               Whether the sides swap colors every second game, 1 or 0 (default: 1)" << std::endl
+        << "  --threads N            Number of games played in parallel (default: 1)" << std::endl
+        << "  --seed N               Seed of the first game (default: 1)" << std::endl;
+}
+
+SelfPlayOptions readArguments(int argc, char *argv[])
+{
+    SelfPlayOptions options = {10, 11, 100, 1000, 1, 1, true, "ai", "ai", 0, 0, 0, 0};
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 >= argc)
+            throw std::invalid_argument(std::string("Missing value for ") + argv[i]);
+
+        const char* value = argv[++i];
+
+        if (strcmp(argv[i - 1], "--games") == 0)
+            options.games = std::atoi(value);
+        else if (strcmp(argv[i - 1], "--size") == 0)
+            options.size = std::atoi(value);
+        else if (strcmp(argv[i - 1], "--blue") == 0)
+            options.blue = value;
+        else if (strcmp(argv[i - 1], "--red") == 0)
+            options.red = value;
+        else if (strcmp(argv[i - 1], "--simulations") == 0)
+            options.simulations = std::atoi(value);
+        else if (strcmp(argv[i - 1], "--blue-simulations") == 0)
+            options.blueSimulations = std::atoi(value);
+        else if (strcmp(argv[i - 1], "--red-simulations") == 0)
+            options.redSimulations = std::atoi(value);
+        else if (strcmp(argv[i - 1], "--budget") == 0)
+            options.budget = std::atoi(value);
+        else if (strcmp(argv[i - 1], "--blue-budget") == 0)
+            options.blueBudget = std::atoi(value);
+        else if (strcmp(argv[i - 1], "--red-budget") == 0)
+            options.redBudget = std::atoi(value);
+        else if (strcmp(argv[i - 1], "--swap") == 0)
+            options.swap = std::atoi(value) != 0;
+        else if (strcmp(argv[i - 1], "--threads") == 0)
+            options.threads = std::atoi(value);
+        else if (strcmp(argv[i - 1], "--seed") == 0)
+            options.seed = std::strtoull(value, nullptr, 10);
+        else
+            throw std::invalid_argument(std::string("Unknown option ") + argv[i - 1]);
+    }
+
+    // Settings of a side that weren't given fall back to the shared ones
+    if (options.blueSimulations == 0)
+        options.blueSimulations = options.simulations;
+
+    if (options.redSimulations == 0)
+        options.redSimulations = options.simulations;
+
+    if (options.blueBudget == 0)
+        options.blueBudget = options.budget;
+
+    if (options.redBudget == 0)
+        options.redBudget = options.budget;
+
+    if (options.games < 1 || options.threads < 1
+            || options.blueSimulations < 1 || options.redSimulations < 1
+            || options.blueBudget < 1 || options.redBudget < 1)
+        throw std::invalid_argument("Games, threads, simulations and budgets must be positive");
+
+    if (options.size < 2 || options.size > MAX_BOARD_SIZE)
+        throw std::invalid_argument("The size must be between 2 and " + std::to_string(MAX_BOARD_SIZE));
+
+    return options;
+}
+
+std::unique_ptr<MoveStrategy> createStrategy(const std::string& name, Turn player, int simulations, int budget, uint64_t seed)
+{
+    if (name == "ai")
+        return std::make_unique<AIStrategy>(player, simulations, 1, seed);
+
+    if (name == "bridges")
+        return std::make_unique<AIStrategy>(player, simulations, 1, seed, true);
+
+    if (name == "amaf")
+        return std::make_unique<AIStrategy>(player, simulations, 1, seed, false, true);
+
+    if (name == "anytime") {
+        std::unique_ptr<AIStrategy> strategy = std::make_unique<AIStrategy>(player, simulations, 1, seed);
+        strategy->setTimeBudget(budget);
+        return strategy;
+    }
+
+    if (name == "mcts")
+        return std::make_unique<MCTSStrategy>(player, simulations, 1.4, 1 << 18, seed);
+
+    if (name == "resistance")
+        return std::make_unique<ResistanceStrategy>(player, seed);
+
+    if (name == "alphabeta")
+        return std::make_unique<AlphaBetaStrategy>(player, budget);
+
+    throw std::invalid_argument("Unknown strategy " + name);
+}
+
+GameResult playGame(const SelfPlayOptions& options, int game)
+{
+    uint64_t seed = options.seed + game;
+
+    // Each side keeps its seed whatever color it plays
+    GameResult result = {Turn::Undecided, options.swap && game % 2 == 1, {0, 0}, {0.0, 0.0}, 0};
+    Turn blueSideColor = result.swapped ? Turn::Red : Turn::Blue;
+    Turn redSideColor = result.swapped ? Turn::Blue : Turn::Red;
+
+    std::unique_ptr<MoveStrategy> sides[2] = {
+        createStrategy(options.blue, blueSideColor, options.blueSimulations, options.blueBudget, seed * 2),
+        createStrategy(options.red, redSideColor, options.redSimulations, options.redBudget, seed * 2 + 1)
+    };
+
+    // Both players are driven from here, so the board treats them as humans
+    Board board(options.size, {true, true});
+
+    while (board.playerWon() == Turn::Undecided) {
+        int side = (board.current() == Turn::Blue) == result.swapped ? 1 : 0;
+
+        auto start = std::chrono::steady_clock::now();
+        Position position = sides[side]->getNextMove(board);
+        auto end = std::chrono::steady_clock::now();
+
+        board.set(position.first, position.second);
+
+        result.moves[side]++;
+        result.moveSeconds[side] += std::chrono::duration<double>(end - start).count();
+    }
+
+    result.winner = board.playerWon();
+    result.simulations = sides[0]->countSimulations() + sides[1]->countSimulations();
+
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SelfPlayOptions options;
+
+    try {
+        options = readArguments(argc, argv);
+        createStrategy(options.blue, Turn::Blue, options.blueSimulations, options.blueBudget, 0);
+        createStrategy(options.red, Turn::Red, options.redSimulations, options.redBudget, 0);
+    } catch (const std::invalid_argument& error) {
+        std::cerr << error.what() << std::endl;
+        printUsage();
+        return 1;
+    }
+
+    std::vector<GameResult> results(options.games);
+    std::atomic<int> nextGame(0);
+
+    auto start = std::chrono::steady_clock::now();
+
+    // Each thread keeps taking the next pending game until none is left
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < std::min(options.threads, options.games); i++) {
+        threads.emplace_back([&options, &results, &nextGame]() {
+            for (int game = nextGame++; game < options.games; game = nextGame++)
+                results[game] = playGame(options, game);
+        });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const std::string names[2] = {options.blue, options.red};
+    const char* sideNames[2] = {"blue side", "red side"};
+    int wins[2] = {0, 0};
+    int winsAsBlue[2] = {0, 0};
+    long long moves[2] = {0, 0};
+    double moveSeconds[2] = {0.0, 0.0};
+    int blueWins = 0;
+    long long simulations = 0;
+
+    for (int game = 0; game < options.games; game++) {
+        const GameResult& result = results[game];
+        int winner = (result.winner == Turn::Blue) == result.swapped ? 1 : 0;
+
+        std::cout << "Game " << game + 1 << ": "
+            << names[winner] << " (" << sideNames[winner] << ") won as "
+            << (result.winner == Turn::Blue ? "blue" : "red")
+            << " in " << result.moves[0] + result.moves[1] << " moves" << std::endl;
+
+        wins[winner]++;
+
+        if (result.winner == Turn::Blue) {
+            winsAsBlue[winner]++;
+            blueWins++;
+        }
+
+        for (int side = 0; side < 2; side++) {
+            moves[side] += result.moves[side];
+            moveSeconds[side] += result.moveSeconds[side];
+        }
+
+        simulations += result.simulations;
+    }
+
+    std::cout << std::endl
+        << "Board:         " << options.size << "x" << options.size << std::endl;
+
+    const char* labels[2] = {"Blue side:     ", "Red side:      "};
+
+    for (int side = 0; side < 2; side++) {
+        std::cout << labels[side] << names[side]
+            << " (" << wins[side] << " wins, " << winsAsBlue[side] << " as blue, "
+            << 1000.0 * moveSeconds[side] / std::max(1LL, moves[side]) << " ms per move)" << std::endl;
+    }
+
+    std::cout
+        << "Blue won:      " << blueWins << " of " << options.games << std::endl
+        << "Games/sec:     " << options.games / seconds << std::endl
+        << "Rollouts/sec:  " << simulations / seconds << std::endl;
+
+    return 0;
+}
@@ -1,17 +1,158 @@
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
 #include "strategy.hpp"
 #include "ai.hpp"
 #include "board.hpp"
 
+AIStrategy::AIStrategy(Turn player, int simulationCount, int threadCount, uint64_t seed, bool answerBridges, bool amaf) :
+    player(player),
+    simulationCount(simulationCount),
+    threadCount(threadCount),
+    random(seed),
+    answerBridges(answerBridges),
+    amaf(amaf),
+    timeBudget(0),
+    simulations(0),
+    pondering(false),
+    pondered(0) {}
+
+AIStrategy::~AIStrategy() {
+    stopPondering();
+}
+
+void AIStrategy::setTimeBudget(int milliseconds) {
+    timeBudget = std::max(0, milliseconds);
+}
+
 Position AIStrategy::getNextMove(const Board& board) {
-    // Use the existing AI code to calculate the best move
-    Ai ai(player);
-    ai.readBoard(board);
+    // The budget counts from the call, so that preparing the workers is included
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeBudget);
+    int remaining = simulationCount + 1;
+
+    stopPondering();
+
+    // Run a share of the simulations, or keep simulating until the deadline
+    auto run = [this, deadline](Ai& ai, int share) {
+        long long count = 0;
+
+        if (timeBudget > 0) {
+            do {
+                ai.simulate();
+                count++;
+            } while (std::chrono::steady_clock::now() < deadline);
+        } else {
+            for (; count < share; count++) {
+                ai.simulate();
+            }
+        }
+
+        return count;
+    };
+
+    // Each worker has its own AI, with its own copy of the board
+    // and its own evaluation, so that they share nothing while running
+    int workerCount = timeBudget > 0 ? std::max(1, threadCount) : std::max(1, std::min(threadCount, remaining));
+
+    if ((int) workers.size() != workerCount) {
+        workers.clear();
+        workers.reserve(workerCount);
 
-    // Run simulations to determine the best move
-    for (int i = 0; i <= simulationCount; i++) {
-        ai.simulate();
+        for (int i = 0; i < workerCount; i++) {
+            workers.emplace_back(player, random(), answerBridges, amaf);
+            workers[i].keepRollouts(true);
+        }
+    }
+
+    // Every worker replays the rollouts of the previous move that still
+    // apply, and the first one also starts from the pondered results.
+    // They count as simulations that don't need to be run again
+    int reused = 0;
+
+    if (ponderer) {
+        // Pondered rollouts beyond the simulations of a move only take time to replay
+        reused += timeBudget > 0 ? workers[0].readPonderedBoard(*ponderer, board) : workers[0].readPonderedBoard(*ponderer, board, remaining);
+        ponderer.reset();
+    } else {
+        reused += workers[0].readBoard(board);
+    }
+
+    for (int i = 1; i < workerCount; i++) {
+        reused += workers[i].readBoard(board);
+    }
+
+    remaining = std::max(1, remaining - reused);
+
+    // Only as many threads as simulations are left are started, but the
+    // replayed rollouts of every worker are merged
+    int threadsUsed = timeBudget > 0 ? workerCount : std::min(workerCount, remaining);
+
+    if (threadsUsed == 1) {
+        // Run simulations to determine the best move
+        simulations += run(workers[0], remaining);
+    } else {
+        std::vector<std::thread> threads;
+        std::vector<long long> counts(threadsUsed, 0);
+        threads.reserve(threadsUsed);
+
+        for (int i = 0; i < threadsUsed; i++) {
+            int share = remaining / threadsUsed + (i < remaining % threadsUsed ? 1 : 0);
+
+            threads.emplace_back([this, &counts, &run, i, share]() {
+                counts[i] = run(workers[i], share);
+            });
+        }
+
+        for (int i = 0; i < threadsUsed; i++) {
+            threads[i].join();
+            simulations += counts[i];
+        }
+    }
+
+    // Merge every evaluation into the first worker
+    for (int i = 1; i < workerCount; i++) {
+        workers[0].merge(workers[i]);
     }
 
     // Return the best position found by the AI
-    return ai.getBestPosition();
-}
\ No newline at end of file
+    return workers[0].getBestPosition();
+}
+
+long long AIStrategy::countSimulations() const {
+    return simulations;
+}
+
+int AIStrategy::countPonderedSimulations() const {
+    return pondered;
+}
+
+void AIStrategy::ponder(const Board& board) {
+    stopPondering();
+
+    if (board.current() == player || board.playerWon() != Turn::Undecided) {
+        return;
+    }
+
+    ponderer = std::make_unique<Ai>(player, random(), answerBridges, amaf);
+    ponderer->keepRollouts(true, PONDER_LIMIT);
+    ponderer->readBoard(board);
+    pondering = true;
+    pondered = 0;
+
+    // A single thread is enough to use the idle time without
+    // taking the processor away from the user interface
+    ponderThread = std::thread([this]() {
+        while (pondering && ponderer->ponder()) {
+            pondered++;
+        }
+    });
+}
+
+void AIStrategy::stopPondering() {
+    pondering = false;
+
+    if (ponderThread.joinable()) {
+        ponderThread.join();
+    }
+}
@@ -1,10 +1,16 @@
 #ifndef STRATEGY_H
 #define STRATEGY_H
 
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
 #include "common.hpp"
+#include "random.hpp"
 
 // Forward declarations
 class Board;
+class Ai;
 typedef std::pair<int, int> Position;
 // enum Turn; // Ya está incluido en common.hpp
 
@@ -20,6 +26,26 @@ public:
      * @return Position The best position found for the next move
      */
     virtual Position getNextMove(const Board& board) = 0;
+
+    /**
+     * Get the number of simulated games played so far by the strategy
+     *
+     * @return Number of simulations, 0 for strategies that don't simulate
+     */
+    virtual long long countSimulations() const { return 0; }
+
+    /**
+     * Start thinking in the background while the opponent is on turn.
+     * Strategies that don't ponder ignore it.
+     *
+     * @param board Game board, with the opponent on turn
+     */
+    virtual void ponder(const Board& /*board*/) {}
+
+    /**
+     * Stop thinking in the background, if the strategy was pondering.
+     */
+    virtual void stopPondering() {}
     
     /**
      * Virtual destructor for proper cleanup
@@ -34,17 +60,56 @@ class AIStrategy : public MoveStrategy {
 private:
     Turn player;
     int simulationCount;
+    int threadCount;
+    Random random;
+    bool answerBridges;
+    bool amaf;
+    int timeBudget;
+    long long simulations;
+
+    // AI of each thread, kept between moves so that their rollouts
+    // are replayed when they still apply
+    std::vector<Ai> workers;
+
+    // Background simulations run on the opponent's time
+    std::unique_ptr<Ai> ponderer;
+    std::thread ponderThread;
+    std::atomic<bool> pondering;
+    std::atomic<int> pondered;
     
 public:
+    /**
+     * Maximum number of simulations run while pondering a position. Each
+     * one is kept until the opponent moves, so this bounds both the time
+     * and the memory spent on a long wait
+     */
+    static constexpr int PONDER_LIMIT = 1 << 17;
+
     /**
      * Create an AI strategy for a specific player
      * 
      * @param player The player color (Blue or Red)
      * @param simulationCount Number of simulations to run (default: 100)
+     * @param threadCount Number of threads the simulations are spread over (default: 1)
+     * @param seed Seed that makes the moves reproducible (default: taken from the system)
+     * @param answerBridges Whether the simulations answer bridge intrusions (default: false)
+     * @param amaf Whether moves are chosen from all-moves-as-first statistics (default: false)
+     */
+    AIStrategy(Turn player, int simulationCount = 100, int threadCount = 1, uint64_t seed = Random::systemSeed(), bool answerBridges = false, bool amaf = false);
+
+    /**
+     * Stop pondering before the strategy is destroyed
+     */
+    ~AIStrategy() override;
+
+    /**
+     * Switch to a deadline mode where, instead of a fixed number of
+     * simulations, each move simulates until a time budget is spent.
+     * At least one simulation is always run.
+     *
+     * @param milliseconds Time per move, or 0 to go back to the simulation count
      */
-    AIStrategy(Turn player, int simulationCount = 100) : 
-        player(player), 
-        simulationCount(simulationCount) {}
+    void setTimeBudget(int milliseconds);
 
     /**
      * Calculate the next move using AI simulations
@@ -53,6 +118,35 @@ public:
      * @return Position The best position found for the next move
      */
     Position getNextMove(const Board& board) override;
+
+    /**
+     * Get the number of simulations run in all the calls to getNextMove
+     *
+     * @return Number of simulations
+     */
+    long long countSimulations() const override;
+
+    /**
+     * Get the number of simulations run while pondering the last position
+     *
+     * @return Number of pondered simulations
+     */
+    int countPonderedSimulations() const;
+
+    /**
+     * Run simulations on a background thread until the opponent moves,
+     * or until PONDER_LIMIT simulations have been run.
+     * The next call to getNextMove starts from their results, as long as
+     * its board is this one plus the opponent's move.
+     *
+     * @param board Game board, with the opponent on turn
+     */
+    void ponder(const Board& board) override;
+
+    /**
+     * Stop the background simulations, keeping their results.
+     */
+    void stopPondering() override;
 };
 
 #endif // STRATEGY_H
\ No newline at end of file
@@ -0,0 +1,63 @@
+#include <algorithm>
+#include "union_find.hpp"
+
+UnionFind::UnionFind(int nodes) : nodes(nodes), parents(nodes), ranks(nodes, 0)
+{
+    reset();
+}
+
+void UnionFind::reset()
+{
+    for (int node = 0; node < nodes; ++node)
+        parents[node] = node;
+
+    std::fill(ranks.begin(), ranks.end(), 0);
+}
+
+int UnionFind::find(int node)
+{
+    if (node < 0 || node >= nodes)
+        throw std::out_of_range("The node doesn't exist");
+
+    int root = node;
+
+    while (parents[root] != root)
+        root = parents[root];
+
+    // Compress the path so that future lookups hit the root directly
+    while (parents[node] != root) {
+        int next = parents[node];
+        parents[node] = root;
+        node = next;
+    }
+
+    return root;
+}
+
+void UnionFind::unite(int a, int b)
+{
+    int rootA = find(a);
+    int rootB = find(b);
+
+    if (rootA == rootB)
+        return;
+
+    if (ranks[rootA] < ranks[rootB]) {
+        parents[rootA] = rootB;
+    } else if (ranks[rootA] > ranks[rootB]) {
+        parents[rootB] = rootA;
+    } else {
+        parents[rootB] = rootA;
+        ranks[rootA]++;
+    }
+}
+
+bool UnionFind::connected(int a, int b)
+{
+    return find(a) == find(b);
+}
+
+const int& UnionFind::countNodes() const
+{
+    return nodes;
+}
@@ -0,0 +1,76 @@
+#ifndef UNION_FIND_H
+#define UNION_FIND_H
+
+#include <vector>
+#include <stdexcept>
+
+/**
+ * The UnionFind class keeps track of a partition of nodes into
+ * disjoint sets, which makes it possible to answer whether two
+ * nodes are connected without walking any path.
+ *
+ * It uses path compression and union by rank, so each operation
+ * runs in near constant amortized time.
+ *
+ * Sets can be merged but not split.
+ */
+class UnionFind {
+private:
+    // Number of nodes in the structure
+    int nodes;
+
+    // Parent of each node (roots are their own parents)
+    std::vector<int> parents;
+
+    // Upper bound of the height of each root's tree
+    std::vector<int> ranks;
+
+public:
+    /**
+     * Constructor for the UnionFind class.
+     *
+     * @param nodes Number of nodes, each one starting in its own set.
+     */
+    UnionFind(int nodes);
+
+    /**
+     * Put every node back in its own set.
+     */
+    void reset();
+
+    /**
+     * Find the representative of the set that contains a node.
+     *
+     * @param node The node to look for.
+     *
+     * @return The root node of the set.
+     */
+    int find(int node);
+
+    /**
+     * Merge the sets that contain two nodes.
+     *
+     * @param a The first node.
+     * @param b The second node.
+     */
+    void unite(int a, int b);
+
+    /**
+     * Check if two nodes belong to the same set.
+     *
+     * @param a The first node.
+     * @param b The second node.
+     *
+     * @return Whether the two nodes are connected.
+     */
+    bool connected(int a, int b);
+
+    /**
+     * Get the number of nodes.
+     *
+     * @return Number of nodes.
+     */
+    const int& countNodes() const;
+};
+
+#endif // UNION_FIND_H
@@ -1,11 +1,12 @@
+#include <atomic>
 #include "window.hpp"
 
 /**
  * We use `allocations` to track the number of allocations
  * made while building the program.
  */
-static int allocations = 0;
-static int deallocations = 0;
+static std::atomic<int> allocations(0);
+static std::atomic<int> deallocations(0);
 
 void* operator new(size_t size)
 {
@@ -62,8 +63,8 @@ void Window::printHeader(int& row, int&col)
         board.countMovements(),
         row + 1,
         col + 1,
-        allocations,
-        deallocations
+        allocations.load(),
+        deallocations.load()
     );
 }
 
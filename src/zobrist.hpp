@@ -0,0 +1,73 @@
+#ifndef ZOBRIST_H
+#define ZOBRIST_H
+
+#include <cstdint>
+#include "common.hpp"
+#include "random.hpp"
+
+/**
+ * The `ZobristKeys` class holds the random keys used to hash positions:
+ * one per cell and color, plus one for the red player being on turn.
+ *
+ * The hash of a position is the xor of the keys of its stones, so it can
+ * be updated with a single xor whenever a stone is added or changed.
+ * Keys come from a fixed seed, so hashes are stable between runs and can
+ * be stored in opening books or caches.
+ */
+class ZobristKeys
+{
+private:
+    uint64_t stones[MAX_BOARD_SIZE * MAX_BOARD_SIZE][2];
+    uint64_t redTurn;
+
+public:
+    /**
+     * Generate the keys from a seed.
+     *
+     * @param seed Seed of the keys.
+     */
+    explicit ZobristKeys(uint64_t seed) {
+        Random random(seed);
+
+        for (auto& cell : stones) {
+            cell[0] = random();
+            cell[1] = random();
+        }
+
+        redTurn = random();
+    }
+
+    /**
+     * Get the key of a stone.
+     *
+     * @param cell Cell number (row * size + col).
+     * @param turn Color of the stone.
+     *
+     * @return Key of the stone.
+     */
+    uint64_t stone(int cell, Turn turn) const {
+        return stones[cell][turn == Turn::Red ? 1 : 0];
+    }
+
+    /**
+     * Get the key added when the red player is on turn.
+     *
+     * @return Key of the turn.
+     */
+    uint64_t turn() const {
+        return redTurn;
+    }
+
+    /**
+     * Get the keys shared by every board.
+     *
+     * @return Keys generated from a fixed seed.
+     */
+    static const ZobristKeys& shared() {
+        static const ZobristKeys keys(0x5eed2a0b215ull);
+
+        return keys;
+    }
+};
+
+#endif // ZOBRIST_H
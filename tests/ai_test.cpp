@@ -1,6 +1,8 @@
 #ifndef __AI_TEST__
 #define __AI_TEST__
 
+#include <chrono>
+#include <thread>
 #include <gtest/gtest.h>
 #include "../src/ai.hpp"
 
@@ -36,6 +38,63 @@ TEST(AiTests, getBestPosition) {
     ASSERT_EQ(evaluation.getBestPosition(), Position({1, 1}));
 }
 
+TEST(AiTests, merge) {
+    BoardEvaluation evaluation(9);
+    BoardEvaluation other(9);
+
+    evaluation.increaseScore(1, 1);
+    other.increaseScore(1, 1);
+    other.decreaseScore(2, 2);
+    other.deactivate(0, 0);
+
+    evaluation.merge(other);
+
+    ASSERT_EQ(evaluation.getScore(1, 1), 2);
+    ASSERT_EQ(evaluation.getScore(2, 2), -1);
+    ASSERT_EQ(evaluation.getScore(0, 0), std::numeric_limits<int>::min());
+}
+
+TEST(AiTests, amafScore) {
+    BoardEvaluation evaluation(9, true);
+
+    ASSERT_TRUE(evaluation.usesAmaf());
+    ASSERT_DOUBLE_EQ(evaluation.getAmafScore(1, 1, Turn::Blue), 0.5);
+
+    // Blue wins whenever it takes (1,1), red wins when it takes it
+    evaluation.record(1, 1, Turn::Blue, true);
+    evaluation.record(1, 1, Turn::Blue, true);
+    evaluation.record(1, 1, Turn::Red, true);
+
+    // Blue loses half of the times it takes (2,2), red always loses there
+    evaluation.record(2, 2, Turn::Blue, true);
+    evaluation.record(2, 2, Turn::Blue, false);
+    evaluation.record(2, 2, Turn::Red, false);
+
+    ASSERT_DOUBLE_EQ(evaluation.getAmafScore(1, 1, Turn::Blue), 1.0);
+    ASSERT_DOUBLE_EQ(evaluation.getAmafScore(2, 2, Turn::Blue), 0.25);
+    ASSERT_DOUBLE_EQ(evaluation.getAmafScore(2, 2, Turn::Red), 0.25);
+
+    ASSERT_EQ(evaluation.getBestPosition(Turn::Blue), Position({1, 1}));
+
+    // Unexplored cells are preferred to bad ones
+    evaluation.deactivate(1, 1);
+    ASSERT_NE(evaluation.getBestPosition(Turn::Blue), Position({2, 2}));
+}
+
+TEST(AiTests, mergeAmaf) {
+    BoardEvaluation evaluation(9, true);
+    BoardEvaluation other(9, true);
+
+    evaluation.record(1, 1, Turn::Red, true);
+    other.record(1, 1, Turn::Red, false);
+    other.record(1, 1, Turn::Blue, true);
+
+    evaluation.merge(other);
+
+    ASSERT_DOUBLE_EQ(evaluation.getAmafScore(1, 1, Turn::Red), 0.75);
+    ASSERT_DOUBLE_EQ(evaluation.getAmafScore(1, 1, Turn::Blue), 0.75);
+}
+
 TEST(AiTests, simulate) {
     Ai ai(Turn::Blue);
     Board board(3, HumanPlayers({true, true}));
@@ -55,4 +114,253 @@ TEST(AiTests, simulate) {
     ASSERT_EQ(ai.getBestPosition(), Position({0, 2}));
 }
 
+TEST(AiTests, reproducibleStrategy) {
+    Board board(5, HumanPlayers({true, true}));
+
+    board.set(2, 2);
+
+    AIStrategy first(Turn::Red, 50, 1, 1234);
+    AIStrategy second(Turn::Red, 50, 1, 1234);
+
+    ASSERT_EQ(first.getNextMove(board), second.getNextMove(board));
+    ASSERT_EQ(first.getNextMove(board), second.getNextMove(board));
+}
+
+TEST(AiTests, countSimulations) {
+    Board board(3, HumanPlayers({true, true}));
+    AIStrategy strategy(Turn::Blue, 20, 2);
+
+    ASSERT_EQ(strategy.countSimulations(), 0);
+
+    strategy.getNextMove(board);
+
+    ASSERT_EQ(strategy.countSimulations(), 21);
+}
+
+TEST(AiTests, parallelStrategy) {
+    AIStrategy strategy(Turn::Blue, 100, 4);
+    Board board(3, HumanPlayers({true, true}));
+
+    board.set(0, 0);
+    board.set(2, 0);
+    board.set(0, 1);
+    board.set(2, 1);
+    board.set(1, 0);
+    board.set(2, 2);
+    board.set(1, 1);
+    board.set(1, 2);
+
+    ASSERT_EQ(strategy.getNextMove(board), Position({0, 2}));
+}
+
+TEST(AiTests, amafStrategy) {
+    AIStrategy strategy(Turn::Blue, 100, 1, 1, false, true);
+    Board board(3, HumanPlayers({true, true}));
+
+    board.set(0, 0);
+    board.set(2, 0);
+    board.set(0, 1);
+    board.set(2, 1);
+    board.set(1, 0);
+    board.set(1, 2);
+
+    ASSERT_EQ(strategy.getNextMove(board), Position({0, 2}));
+}
+
+TEST(AiTests, timeBudget) {
+    Board board(11, HumanPlayers({true, true}));
+    AIStrategy strategy(Turn::Blue, 1, 1, 1);
+
+    strategy.setTimeBudget(50);
+
+    auto start = std::chrono::steady_clock::now();
+    strategy.getNextMove(board);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ASSERT_GE(elapsed, std::chrono::milliseconds(50));
+    ASSERT_GT(strategy.countSimulations(), 2);
+}
+
+TEST(AiTests, parallelTimeBudget) {
+    AIStrategy strategy(Turn::Blue, 1, 4, 1);
+    Board board(3, HumanPlayers({true, true}));
+
+    board.set(0, 0);
+    board.set(2, 0);
+    board.set(0, 1);
+    board.set(2, 1);
+    board.set(1, 0);
+    board.set(2, 2);
+    board.set(1, 1);
+    board.set(1, 2);
+
+    strategy.setTimeBudget(20);
+
+    ASSERT_EQ(strategy.getNextMove(board), Position({0, 2}));
+    ASSERT_GT(strategy.countSimulations(), 4);
+}
+
+TEST(AiTests, ponder) {
+    Ai ai(Turn::Blue, 1);
+    Board board(3, HumanPlayers({true, true}));
+
+    board.set(0, 0);
+    board.set(2, 0);
+    board.set(0, 1);
+    board.set(2, 1);
+    board.set(1, 0);
+
+    // Without keeping rollouts there's nowhere to ponder into
+    ai.readBoard(board);
+    ASSERT_FALSE(ai.ponder());
+
+    ai.keepRollouts(true, 100);
+    ai.readBoard(board);
+
+    for (int i = 0; i < 100; i++) {
+        ASSERT_TRUE(ai.ponder());
+    }
+
+    ASSERT_FALSE(ai.ponder());
+
+    Board next = board;
+    next.set(1, 2);
+
+    Ai reply(Turn::Blue, 2);
+    ASSERT_GT(reply.readPonderedBoard(ai, next), 0);
+
+    reply.simulate();
+    ASSERT_EQ(reply.getBestPosition(), Position({0, 2}));
+
+    // Only as many pondered rollouts as requested are replayed
+    Ai limited(Turn::Blue, 3);
+    ASSERT_EQ(limited.readPonderedBoard(ai, next, 5), 5);
+
+    // Boards that don't follow the pondered one start from scratch
+    Board other(3, HumanPlayers({true, true}));
+    other.set(1, 1);
+    other.set(2, 2);
+
+    ASSERT_EQ(reply.readPonderedBoard(ai, other), 0);
+}
+
+TEST(AiTests, ponderingStrategy) {
+    AIStrategy strategy(Turn::Blue, 1000, 1, 1);
+    Board board(3, HumanPlayers({true, true}));
+
+    board.set(0, 0);
+    board.set(2, 0);
+    board.set(0, 1);
+    board.set(2, 1);
+    board.set(1, 0);
+
+    // Nothing to ponder on the strategy's own turn
+    Board own(3, HumanPlayers({true, true}));
+    strategy.ponder(own);
+    strategy.stopPondering();
+
+    strategy.ponder(board);
+
+    while (strategy.countPonderedSimulations() < 100) {
+        std::this_thread::yield();
+    }
+
+    board.set(1, 2);
+
+    ASSERT_EQ(strategy.getNextMove(board), Position({0, 2}));
+    ASSERT_LT(strategy.countSimulations(), 1001);
+}
+
+TEST(AiTests, replayRollouts) {
+    Ai ai(Turn::Blue, 1);
+    Board board(5, HumanPlayers({true, true}));
+
+    board.set(2, 2);
+    board.set(1, 3);
+
+    ai.keepRollouts(true);
+    ASSERT_EQ(ai.readBoard(board), 0);
+
+    for (int i = 0; i < 200; i++) {
+        ai.simulate();
+    }
+
+    board.set(3, 1);
+    board.set(1, 1);
+
+    int replayed = ai.readBoard(board);
+    ASSERT_GT(replayed, 0);
+    ASSERT_LT(replayed, 200);
+
+    // A board with a different history can't reuse them
+    board.set(0, 0);
+
+    ASSERT_EQ(ai.readBoard(board), 0);
+
+    // Without keeping rollouts, nothing is replayed
+    Ai other(Turn::Blue, 2);
+    other.readBoard(board);
+
+    for (int i = 0; i < 200; i++) {
+        other.simulate();
+    }
+
+    board.set(0, 1);
+    board.set(0, 2);
+
+    ASSERT_EQ(other.readBoard(board), 0);
+}
+
+TEST(AiTests, rolloutCapacity) {
+    Ai ai(Turn::Blue, 1);
+    Board board(5, HumanPlayers({true, true}));
+
+    board.set(2, 2);
+    board.set(1, 3);
+
+    ai.keepRollouts(true);
+    ai.readBoard(board);
+
+    for (int i = 0; i < 2 * Ai::ROLLOUT_CAPACITY; i++) {
+        ai.simulate();
+    }
+
+    board.set(3, 1);
+    board.set(1, 1);
+
+    int replayed = ai.readBoard(board);
+    ASSERT_GT(replayed, 0);
+    ASSERT_LE(replayed, Ai::ROLLOUT_CAPACITY);
+}
+
+TEST(AiTests, carryStatistics) {
+    AIStrategy strategy(Turn::Blue, 200, 1, 1);
+    Board board(5, HumanPlayers({true, true}));
+
+    Position move = strategy.getNextMove(board);
+    ASSERT_EQ(strategy.countSimulations(), 201);
+
+    board.set(move.first, move.second);
+    board.set(move.first == 0 ? 4 : 0, 0);
+
+    strategy.getNextMove(board);
+    ASSERT_LT(strategy.countSimulations(), 402);
+}
+
+TEST(AiTests, parallelCarryStatistics) {
+    AIStrategy strategy(Turn::Blue, 8, 4, 1);
+    Board board(5, HumanPlayers({true, true}));
+
+    Position move = strategy.getNextMove(board);
+    ASSERT_EQ(strategy.countSimulations(), 9);
+
+    board.set(move.first, move.second);
+    board.set(move.first == 0 ? 4 : 0, 0);
+
+    // Whatever the rollouts cover, at least one simulation is run
+    strategy.getNextMove(board);
+    ASSERT_GE(strategy.countSimulations(), 10);
+    ASSERT_LE(strategy.countSimulations(), 18);
+}
+
 #endif // __AI_TEST__
\ No newline at end of file
@@ -0,0 +1,96 @@
+#ifndef __ALPHA_BETA_TEST__
+#define __ALPHA_BETA_TEST__
+
+#include <gtest/gtest.h>
+#include "../src/board.hpp"
+#include "../src/alpha_beta.hpp"
+
+TEST(TranspositionTableTests, storeAndProbe) {
+    TranspositionTable table(4);
+    TranspositionEntry entry;
+
+    ASSERT_FALSE(table.probe(12345, entry));
+
+    table.store(12345, {-250, 7, 3, LowerBound});
+
+    ASSERT_TRUE(table.probe(12345, entry));
+    ASSERT_EQ(entry.score, -250);
+    ASSERT_EQ(entry.move, 7);
+    ASSERT_EQ(entry.depth, 3);
+    ASSERT_EQ(entry.bound, LowerBound);
+
+    // Same slot, different key
+    ASSERT_FALSE(table.probe(12345 + 16, entry));
+
+    table.clear();
+
+    ASSERT_FALSE(table.probe(12345, entry));
+}
+
+TEST(AlphaBetaStrategyTests, takesTheWinningMove) {
+    Board board(3, {true, true});
+
+    // Blue to move, with (0,2) as the only cell that connects
+    board.set(0, 0);
+    board.set(2, 0);
+    board.set(0, 1);
+    board.set(2, 1);
+    board.set(1, 0);
+    board.set(1, 2);
+
+    AlphaBetaStrategy strategy(Turn::Blue, 100, 8, 10);
+
+    ASSERT_EQ(strategy.getNextMove(board), Position({0, 2}));
+}
+
+TEST(AlphaBetaStrategyTests, blocksTheWinningMove) {
+    Board board(3, {true, true});
+
+    // Red to move, and blue would connect through (0,2)
+    board.set(0, 0);
+    board.set(2, 0);
+    board.set(0, 1);
+    board.set(2, 1);
+    board.set(1, 0);
+    board.set(1, 2);
+    board.set(2, 2);
+
+    AlphaBetaStrategy strategy(Turn::Red, 100, 8, 10);
+
+    ASSERT_EQ(strategy.getNextMove(board), Position({0, 2}));
+}
+
+TEST(AlphaBetaStrategyTests, findsAForcedWin) {
+    Board board(3, {true, true});
+
+    // Blue in the center wins on a 3x3 board whatever red does
+    board.set(1, 1);
+    board.set(0, 0);
+
+    AlphaBetaStrategy strategy(Turn::Blue, 1000, 8, 12);
+    Position move = strategy.getNextMove(board);
+    board.set(move.first, move.second);
+
+    while (board.playerWon() == Turn::Undecided) {
+        if (board.current() == Turn::Blue) {
+            move = strategy.getNextMove(board);
+        } else {
+            // Red plays the first empty cell
+            int first = -1;
+
+            board.getOccupied().complement().forEach([&first](int cell) {
+                if (first == -1)
+                    first = cell;
+            });
+
+            move = Position({first / 3, first % 3});
+        }
+
+        board.set(move.first, move.second);
+    }
+
+    ASSERT_EQ(board.playerWon(), Turn::Blue);
+    ASSERT_GT(strategy.countNodes(), 0);
+}
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef __BITBOARD_TEST__
+#define __BITBOARD_TEST__
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "../src/bitboard.hpp"
+
+TEST(BitboardTests, set) {
+    Bitboard bitboard(9);
+
+    ASSERT_EQ(bitboard.test(4), false);
+
+    bitboard.set(4);
+
+    ASSERT_EQ(bitboard.test(4), true);
+
+    bitboard.reset(4);
+
+    ASSERT_EQ(bitboard.test(4), false);
+}
+
+TEST(BitboardTests, count) {
+    Bitboard bitboard(23*23);
+
+    bitboard.set(0);
+    bitboard.set(63);
+    bitboard.set(64);
+    bitboard.set(23*23 - 1);
+
+    ASSERT_EQ(bitboard.count(), 4);
+    ASSERT_EQ(bitboard.any(), true);
+}
+
+TEST(BitboardTests, complement) {
+    Bitboard bitboard(9);
+
+    bitboard.set(1);
+    bitboard.set(7);
+
+    Bitboard complement = bitboard.complement();
+
+    ASSERT_EQ(complement.count(), 7);
+    ASSERT_EQ(complement.test(1), false);
+    ASSERT_EQ(complement.test(0), true);
+}
+
+TEST(BitboardTests, operators) {
+    Bitboard a(9);
+    Bitboard b(9);
+
+    a.set(1);
+    a.set(2);
+    b.set(2);
+    b.set(3);
+
+    ASSERT_EQ((a | b).count(), 3);
+    ASSERT_EQ((a & b).count(), 1);
+    ASSERT_EQ((a & b).test(2), true);
+}
+
+TEST(BitboardTests, forEach) {
+    Bitboard bitboard(100);
+
+    bitboard.set(70);
+    bitboard.set(3);
+    bitboard.set(64);
+
+    std::vector<int> cells;
+
+    bitboard.forEach([&cells](int cell) {
+        cells.push_back(cell);
+    });
+
+    std::vector<int> expected = {3, 64, 70};
+
+    ASSERT_EQ(cells, expected);
+}
+
+#endif // __BITBOARD_TEST__
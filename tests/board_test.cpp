@@ -4,6 +4,8 @@
 #include <gtest/gtest.h>
 #include <unordered_set>
 #include <utility>
+#include <algorithm>
+#include <vector>
 #include "../src/board.hpp"
 
 struct pair_hash {
@@ -31,6 +33,27 @@ TEST(BoardTests, copy) {
     ASSERT_EQ(copy.isBlue(1, 2), true);
 }
 
+TEST(BoardTests, copyKeepsConnections) {
+    HumanPlayers humanPlayers = {true, true};
+    Board board(3, humanPlayers);
+
+    board.set(0, 0);
+    board.set(1, 0);
+    board.set(0, 1);
+    board.set(1, 1);
+
+    Board copy(5, humanPlayers);
+    copy = board;
+    copy.set(0, 2);
+
+    HexGraph blueGraph = copy.getBlueGraph();
+
+    ASSERT_EQ(blueGraph.nodesAreConnected(0, 1), true);
+    ASSERT_EQ(copy.playerWon(), Turn::Blue);
+    ASSERT_EQ(board.playerWon(), Turn::Undecided);
+    ASSERT_EQ(board.get(0, 2), Turn::Undecided);
+}
+
 TEST(BoardTests, exists) {
     HumanPlayers humanPlayers = {true, true};
     Board board(3, humanPlayers);
@@ -142,6 +165,40 @@ TEST(BoardTests, playerWon) {
     ASSERT_EQ(board.playerWon(), Turn::Blue);
 }
 
+TEST(BoardTests, redWon) {
+    HumanPlayers humanPlayers = {true, true};
+    Board board(3, humanPlayers);
+
+    board.set(0, 0);
+    board.set(0, 1);
+    board.set(0, 2);
+    board.set(2, 1);
+    board.set(2, 2);
+    board.set(2, 0);
+
+    ASSERT_EQ(board.playerWon(), Turn::Undecided);
+
+    board.set(1, 2);
+    board.set(1, 1);
+
+    ASSERT_EQ(board.playerWon(), Turn::Red);
+}
+
+TEST(BoardTests, playerWonAfterPieRule) {
+    HumanPlayers humanPlayers = {true, true};
+    Board board(2, humanPlayers);
+
+    board.set(0, 0);
+    board.pieRule();
+    board.set(0, 1);
+
+    ASSERT_EQ(board.playerWon(), Turn::Undecided);
+
+    board.set(1, 0);
+
+    ASSERT_EQ(board.playerWon(), Turn::Red);
+}
+
 TEST(BoardTests, set) {
     HumanPlayers humanPlayers = {true, true};
     Board board(3, humanPlayers);
@@ -187,7 +244,7 @@ TEST(BoardTests, getBlueGraph) {
     board.set(0, 1);
     board.set(1, 2);
 
-    Graph blueGraph = board.getBlueGraph();
+    HexGraph blueGraph = board.getBlueGraph();
 
     ASSERT_EQ(blueGraph.nodesAreConnected(0, 1), true);
 }
@@ -201,7 +258,7 @@ TEST(BoardTests, getRedGraph) {
     board.set(0, 1);
     board.set(1, 2);
 
-    Graph redGraph = board.getRedGraph();
+    HexGraph redGraph = board.getRedGraph();
 
     ASSERT_EQ(redGraph.nodesAreConnected(4, 5), true);
 }
@@ -261,6 +318,64 @@ TEST(BoardTests, forEachPiece)
     board.forEachPiece(callback);
 }
 
+TEST(BoardTests, getPieces)
+{
+    HumanPlayers humanPlayers = {true, true};
+    Board board(3, humanPlayers);
+
+    board.set(1, 1);
+    board.set(2, 1);
+    board.set(0, 2);
+
+    ASSERT_EQ(board.getPieces(Turn::Blue).count(), 2);
+    ASSERT_EQ(board.getPieces(Turn::Blue).test(board.cell(0, 2)), true);
+    ASSERT_EQ(board.getPieces(Turn::Red).count(), 1);
+    ASSERT_EQ(board.getPieces(Turn::Red).test(board.cell(2, 1)), true);
+    ASSERT_EQ(board.getOccupied().count(), 3);
+}
+
+TEST(BoardTests, getEmptyCells)
+{
+    HumanPlayers humanPlayers = {true, true};
+    Board board(3, humanPlayers);
+
+    board.set(1, 1);
+    board.set(0, 0);
+    board.set(2, 2);
+
+    const EmptyCells& emptyCells = board.getEmptyCells();
+
+    ASSERT_EQ(emptyCells.size(), 6);
+
+    std::unordered_set<int> cells;
+
+    for (int i = 0; i < emptyCells.size(); i++)
+        cells.insert(emptyCells[i]);
+
+    ASSERT_EQ(cells.size(), 6);
+    ASSERT_EQ(cells.count(board.cell(1, 1)), 0);
+    ASSERT_EQ(cells.count(board.cell(0, 0)), 0);
+    ASSERT_EQ(cells.count(board.cell(2, 2)), 0);
+}
+
+TEST(BoardTests, emptyCellsPermutation)
+{
+    EmptyCells emptyCells(9);
+
+    emptyCells.remove(4);
+    emptyCells.remove(8);
+
+    Random random(3);
+    std::vector<int> order;
+    emptyCells.permutation(random, order);
+
+    std::sort(order.begin(), order.end());
+
+    std::vector<int> expected = {0, 1, 2, 3, 5, 6, 7};
+
+    ASSERT_EQ(order, expected);
+}
+
 TEST(BoardTests, forEachEmptyPosition)
 {
     HumanPlayers humanPlayers = {true, true};
@@ -300,4 +415,62 @@ TEST(BoardTests, aiPlayer)
     ASSERT_EQ(board.countMovements(), 2);
 }
 
+TEST(BoardTests, hashFollowsThePosition) {
+    Board board(5, {true, true});
+    Board other(5, {true, true});
+
+    ASSERT_EQ(board.getHash(), other.getHash());
+
+    board.set(0, 0);
+    ASSERT_NE(board.getHash(), other.getHash());
+
+    // Transposed movements lead to the same hash
+    board.set(1, 1);
+    board.set(2, 2);
+    board.set(3, 3);
+
+    other.set(2, 2);
+    other.set(3, 3);
+    other.set(0, 0);
+    other.set(1, 1);
+
+    ASSERT_EQ(board.getHash(), other.getHash());
+
+    // The player on turn is part of the hash
+    board.set(4, 4);
+    other.set(4, 3);
+    ASSERT_NE(board.getHash(), other.getHash());
+}
+
+TEST(BoardTests, hashIsCopied) {
+    Board board(5, {true, true});
+
+    board.set(2, 2);
+    board.set(1, 3);
+
+    Board copy = board;
+    ASSERT_EQ(copy.getHash(), board.getHash());
+
+    Board assigned(5, {true, true});
+    assigned = board;
+    ASSERT_EQ(assigned.getHash(), board.getHash());
+}
+
+TEST(BoardTests, hashFollowsThePieRule) {
+    Board board(5, {true, true});
+    board.set(2, 2);
+
+    uint64_t before = board.getHash();
+    board.pieRule();
+
+    ASSERT_NE(board.getHash(), before);
+
+    // Same red stone in the center and blue on turn, plus a blue stone in a corner
+    Board swapped(5, {true, true});
+    swapped.set(0, 0);
+    swapped.set(2, 2);
+
+    ASSERT_EQ(board.getHash(), swapped.getHash() ^ ZobristKeys::shared().stone(0, Turn::Blue));
+}
+
 #endif // __BOARD_TEST__
\ No newline at end of file
@@ -0,0 +1,58 @@
+#ifndef __BOUNDED_GRAPH_TEST__
+#define __BOUNDED_GRAPH_TEST__
+
+#include <gtest/gtest.h>
+#include "../src/bounded_graph.hpp"
+
+TEST(BoundedGraphTests, bidirectedConnect) {
+    HexGraph graph(9);
+
+    graph.bidirectedConnect(0, 1);
+    graph.bidirectedConnect(1, 2);
+    graph.bidirectedConnect(2, 0);
+    graph.bidirectedConnect(0, 2);
+
+    ASSERT_EQ(graph.countEdges(), 6);
+}
+
+TEST(BoundedGraphTests, nodesAreConnected) {
+    HexGraph graph(9);
+
+    graph.bidirectedConnect(0, 1);
+    graph.directedConnect(1, 2);
+
+    ASSERT_EQ(graph.nodesAreConnected(0, 1), true);
+    ASSERT_EQ(graph.nodesAreConnected(1, 0), true);
+    ASSERT_EQ(graph.nodesAreConnected(1, 2), true);
+    ASSERT_EQ(graph.nodesAreConnected(2, 1), false);
+}
+
+TEST(BoundedGraphTests, maxDegree) {
+    BoundedGraph<2> graph(4);
+
+    graph.directedConnect(0, 1);
+    graph.directedConnect(0, 2);
+
+    ASSERT_THROW(graph.directedConnect(0, 3), std::length_error);
+    ASSERT_THROW(graph.directedConnect(0, 4), std::out_of_range);
+}
+
+TEST(BoundedGraphTests, forEachEdge) {
+    HexGraph graph(9);
+
+    graph.directedConnect(0, 1);
+    graph.directedConnect(0, 2);
+    graph.directedConnect(1, 3);
+
+    std::vector<int> calledTargets;
+
+    graph.forEachEdge([&calledTargets](const Edge& edge) {
+        calledTargets.push_back(edge.to);
+    });
+
+    std::vector<int> expected = {1, 2, 3};
+
+    ASSERT_EQ(calledTargets, expected);
+}
+
+#endif // __BOUNDED_GRAPH_TEST__
@@ -0,0 +1,78 @@
+#ifndef __BREADTH_FIRST_SEARCH_TEST__
+#define __BREADTH_FIRST_SEARCH_TEST__
+
+#include <gtest/gtest.h>
+#include "../src/breadth_first_search.hpp"
+
+TEST(BreadthFirstSearchTests, findShortestPath) {
+    int nodes = 3*3;
+    Graph graph(nodes, nodes*6);
+
+    graph.bidirectedConnect(0, 1);
+    graph.bidirectedConnect(1, 2);
+    graph.bidirectedConnect(2, 5);
+    graph.bidirectedConnect(5, 8);
+    graph.bidirectedConnect(0, 4);
+    graph.bidirectedConnect(4, 8);
+
+    BreadthFirstSearch search(graph);
+
+    std::vector<int> shortestPath = search.findShortestPath(0, 8);
+    std::vector<int> expected = {0, 4, 8};
+
+    ASSERT_EQ(shortestPath, expected);
+}
+
+TEST(BreadthFirstSearchTests, impossiblePath) {
+    Graph graph(3, 3*2);
+
+    graph.bidirectedConnect(0, 1);
+
+    BreadthFirstSearch search(graph);
+
+    ASSERT_EQ(search.findShortestPath(0, 2).size(), 0);
+}
+
+TEST(BreadthFirstSearchTests, nodesAreConnected) {
+    int nodes = 3*3;
+    Graph graph(nodes, nodes*6);
+
+    graph.bidirectedConnect(0, 1);
+    graph.bidirectedConnect(1, 2);
+    graph.bidirectedConnect(2, 5);
+
+    BreadthFirstSearch search(graph);
+
+    ASSERT_EQ(search.nodesAreConnected(0, 5), true);
+    ASSERT_EQ(search.nodesAreConnected(0, 7), false);
+    ASSERT_EQ(search.nodesAreConnected(0, 0), true);
+}
+
+TEST(BreadthFirstSearchTests, findCheapestCost) {
+    // A line 0 - 1 - 2 - 3 - 4 with a shortcut 0 - 5 - 4
+    Graph graph(6, 12);
+
+    graph.bidirectedConnect(0, 1);
+    graph.bidirectedConnect(1, 2);
+    graph.bidirectedConnect(2, 3);
+    graph.bidirectedConnect(3, 4);
+    graph.bidirectedConnect(0, 5);
+    graph.bidirectedConnect(5, 4);
+
+    BreadthFirstSearch search(graph);
+
+    // The long way is free, the shortcut isn't
+    std::vector<int> costs = {0, 0, 0, 0, 0, 1};
+    ASSERT_EQ(search.findCheapestCost(0, 4, costs), 0);
+
+    costs = {0, 1, 1, 0, 0, 1};
+    ASSERT_EQ(search.findCheapestCost(0, 4, costs), 1);
+
+    costs = {0, 1, BreadthFirstSearch::BLOCKED, 0, 0, BreadthFirstSearch::BLOCKED};
+    ASSERT_EQ(search.findCheapestCost(0, 4, costs), BreadthFirstSearch::UNREACHABLE);
+
+    costs = {1, 0, 0, 0, 1, 1};
+    ASSERT_EQ(search.findCheapestCost(0, 4, costs), 2);
+}
+
+#endif // __BREADTH_FIRST_SEARCH_TEST__
@@ -57,4 +57,42 @@ TEST(DijkstraTests, nodesAreConnected) {
     ASSERT_EQ(dijkstra.nodesAreConnected(0, 7), false);
 }
 
+TEST(DijkstraTests, findShortestPathIntoVector) {
+    int nodes = 3*3;
+    Graph graph(nodes, nodes*6);
+
+    graph.bidirectedConnect(0, 1);
+    graph.bidirectedConnect(1, 2);
+
+    Dijkstra dijkstra(graph);
+
+    std::vector<int> path = {7, 7, 7, 7};
+
+    ASSERT_EQ(dijkstra.findShortestPath(0, 2, path), true);
+    ASSERT_EQ(path, std::vector<int>({0, 1, 2}));
+
+    ASSERT_EQ(dijkstra.findShortestPath(0, 5, path), false);
+    ASSERT_EQ(path.size(), 0);
+}
+
+TEST(DijkstraTests, sharedWorkspace) {
+    Graph small(3, 6);
+    Graph large(9, 9*6);
+
+    small.bidirectedConnect(0, 1);
+    large.bidirectedConnect(0, 4);
+    large.bidirectedConnect(4, 8);
+
+    DijkstraWorkspace workspace;
+    Dijkstra smallDijkstra(small, workspace);
+    Dijkstra largeDijkstra(large, workspace);
+
+    for (int i = 0; i < 3; i++) {
+        ASSERT_EQ(smallDijkstra.nodesAreConnected(0, 1), true);
+        ASSERT_EQ(smallDijkstra.nodesAreConnected(0, 2), false);
+        ASSERT_EQ(largeDijkstra.findShortestPath(0, 8), std::vector<int>({0, 4, 8}));
+        ASSERT_EQ(largeDijkstra.nodesAreConnected(0, 2), false);
+    }
+}
+
 #endif // __DIJKSTRA_TEST__
\ No newline at end of file
@@ -0,0 +1,82 @@
+#ifndef __DISTANCE_EVALUATOR_TEST__
+#define __DISTANCE_EVALUATOR_TEST__
+
+#include <gtest/gtest.h>
+#include "../src/board.hpp"
+#include "../src/distance_evaluator.hpp"
+
+TEST(DistanceEvaluatorTests, emptyBoard) {
+    Board board(3, {true, true});
+    DistanceEvaluator evaluator(3);
+
+    ASSERT_EQ(evaluator.countMissingStones(board, Turn::Blue), 3);
+    ASSERT_EQ(evaluator.countMissingStones(board, Turn::Red), 3);
+    ASSERT_EQ(evaluator.getPotential(board, Turn::Blue), 4);
+    ASSERT_EQ(evaluator.getPotential(board, Turn::Red), 4);
+    ASSERT_EQ(evaluator.evaluate(board, Turn::Blue), 0);
+}
+
+TEST(DistanceEvaluatorTests, ownStonesAreFree) {
+    Board board(3, {true, true});
+    DistanceEvaluator evaluator(3);
+
+    board.set(1, 1);
+
+    ASSERT_EQ(evaluator.countMissingStones(board, Turn::Blue), 2);
+    ASSERT_EQ(evaluator.countMissingStones(board, Turn::Red), 3);
+    ASSERT_LT(evaluator.getPotential(board, Turn::Blue), evaluator.getPotential(board, Turn::Red));
+    ASSERT_GT(evaluator.evaluate(board, Turn::Blue), 0);
+    ASSERT_LT(evaluator.evaluate(board, Turn::Red), 0);
+}
+
+TEST(DistanceEvaluatorTests, enemyStonesBlock) {
+    Board board(3, {true, true});
+    DistanceEvaluator evaluator(3);
+
+    // Red builds a full column while blue plays on the side
+    board.set(0, 0);
+    board.set(0, 1);
+    board.set(2, 0);
+    board.set(1, 1);
+    board.set(2, 2);
+    board.set(2, 1);
+
+    ASSERT_EQ(board.playerWon(), Turn::Red);
+    ASSERT_EQ(evaluator.countMissingStones(board, Turn::Red), 0);
+    ASSERT_EQ(evaluator.getPotential(board, Turn::Red), 0);
+    ASSERT_EQ(evaluator.countMissingStones(board, Turn::Blue), DistanceEvaluator::UNREACHABLE);
+    ASSERT_EQ(evaluator.getPotential(board, Turn::Blue), DistanceEvaluator::UNREACHABLE);
+}
+
+TEST(DistanceEvaluatorTests, brokenBridge) {
+    Board board(5, {true, true});
+    DistanceEvaluator evaluator(5);
+
+    // Red takes one of the two cells between the blue stones
+    board.set(2, 1);
+    board.set(2, 2);
+    board.set(1, 3);
+
+    ASSERT_EQ(evaluator.countMissingStones(board, Turn::Blue), 3);
+    ASSERT_LT(evaluator.getPotential(board, Turn::Blue), evaluator.getPotential(board, Turn::Red));
+}
+
+TEST(DistanceEvaluatorTests, groupOnBorder) {
+    Board board(5, {true, true});
+    DistanceEvaluator evaluator(5);
+
+    // A blue group on the left border, and red stones far from it
+    board.set(2, 0);
+    board.set(0, 4);
+    board.set(2, 1);
+    board.set(4, 0);
+
+    // Both cells next to the group see its liberties as neighbours,
+    // and the lower one can't be reached in any other way
+    ASSERT_EQ(evaluator.getCellPotential(board, Turn::Blue, 1, 0), 7);
+    ASSERT_EQ(evaluator.getCellPotential(board, Turn::Blue, 3, 0), 7);
+    ASSERT_EQ(evaluator.getCellPotential(board, Turn::Blue, 2, 0), DistanceEvaluator::UNREACHABLE);
+    ASSERT_EQ(evaluator.getPotential(board, Turn::Blue), 5);
+}
+
+#endif
@@ -48,6 +48,40 @@ TEST(GraphTests, nodesAreConnected) {
     ASSERT_EQ(graph.nodesAreConnected(2, 1), false);
 }
 
+TEST(GraphTests, duplicatedConnect) {
+    int nodes = 3*3;
+    Graph graph(nodes, nodes*6);
+
+    graph.directedConnect(0, 1);
+    graph.bidirectedConnect(0, 1);
+    graph.bidirectedConnect(1, 0);
+    graph.directedConnect(1, 0);
+
+    ASSERT_EQ(graph.countEdges(), 2);
+}
+
+TEST(GraphTests, nodesAreConnectedWithCollisions) {
+    Graph graph(130, 10);
+
+    graph.directedConnect(0, 1);
+
+    ASSERT_EQ(graph.nodesAreConnected(0, 1), true);
+    ASSERT_EQ(graph.nodesAreConnected(0, 65), false);
+    ASSERT_EQ(graph.nodesAreConnected(0, 129), false);
+
+    graph.directedConnect(0, 65);
+
+    ASSERT_EQ(graph.nodesAreConnected(0, 65), true);
+    ASSERT_EQ(graph.countEdges(), 2);
+}
+
+TEST(GraphTests, invalidConnect) {
+    Graph graph(3, 6);
+
+    ASSERT_THROW(graph.connect(0, 3), std::out_of_range);
+    ASSERT_THROW(graph.connect(3, 0), std::out_of_range);
+}
+
 TEST(GraphTests, countNodes) {
     int nodes = 3*3;
     Graph graph(nodes, nodes*6);
@@ -109,4 +143,34 @@ TEST(GraphTests, forEachEdge)
     }
 }
 
+TEST(GraphTests, compact)
+{
+    int nodes = 3*3;
+    Graph graph(nodes, nodes*6);
+
+    graph.directedConnect(0, 1);
+    graph.directedConnect(1, 3);
+    graph.directedConnect(0, 2);
+    graph.compact();
+
+    ASSERT_EQ(graph.isCompact(), true);
+    ASSERT_EQ(graph.nodesAreConnected(0, 2), true);
+    ASSERT_EQ(graph.nodesAreConnected(2, 0), false);
+
+    std::vector<int> calledTargets;
+
+    graph.forEachEdge([&calledTargets](const Edge edge) {
+        calledTargets.push_back(edge.to);
+    });
+
+    std::vector<int> expected = {1, 2, 3};
+
+    ASSERT_EQ(calledTargets, expected);
+
+    graph.directedConnect(2, 0);
+
+    ASSERT_EQ(graph.isCompact(), false);
+    ASSERT_EQ(graph.nodesAreConnected(2, 0), true);
+}
+
 #endif // __GRAPH_TEST__
\ No newline at end of file
@@ -0,0 +1,51 @@
+#ifndef __MCTS_TEST__
+#define __MCTS_TEST__
+
+#include <gtest/gtest.h>
+#include "../src/mcts.hpp"
+#include "../src/board.hpp"
+
+TEST(MCTSTests, allocate) {
+    NodePool pool(4);
+
+    ASSERT_EQ(pool.allocate(3), 0);
+    ASSERT_EQ(pool.allocate(1), 3);
+    ASSERT_EQ(pool.allocate(1), -1);
+    ASSERT_EQ(pool.size(), 4);
+
+    pool.clear();
+
+    ASSERT_EQ(pool.size(), 0);
+    ASSERT_EQ(pool.allocate(2), 0);
+}
+
+TEST(MCTSTests, winningMove) {
+    MCTSStrategy strategy(Turn::Blue, 500);
+    Board board(3, HumanPlayers({true, true}));
+
+    board.set(0, 0);
+    board.set(2, 0);
+    board.set(0, 1);
+    board.set(2, 1);
+    board.set(1, 0);
+    board.set(1, 2);
+
+    ASSERT_EQ(strategy.getNextMove(board), Position({0, 2}));
+}
+
+TEST(MCTSTests, redMove) {
+    MCTSStrategy strategy(Turn::Red, 500);
+    Board board(3, HumanPlayers({true, true}));
+
+    board.set(0, 0);
+    board.set(2, 0);
+    board.set(0, 1);
+    board.set(2, 1);
+    board.set(1, 0);
+    board.set(1, 2);
+    board.set(2, 2);
+
+    ASSERT_EQ(strategy.getNextMove(board), Position({0, 2}));
+}
+
+#endif // __MCTS_TEST__
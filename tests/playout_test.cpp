@@ -0,0 +1,125 @@
+#ifndef __PLAYOUT_TEST__
+#define __PLAYOUT_TEST__
+
+#include <gtest/gtest.h>
+#include "../src/playout.hpp"
+#include "../src/board.hpp"
+
+TEST(PlayoutTests, fillsBoard) {
+    Board board(5, HumanPlayers({true, true}));
+
+    board.set(2, 2);
+    board.set(1, 3);
+    board.set(3, 1);
+
+    Playout playout;
+    Random random(1);
+    playout.run(board, random);
+
+    int blue = 0;
+    int red = 0;
+
+    for (int cell = 0; cell < 25; ++cell) {
+        if (playout[cell] == Turn::Blue)
+            blue++;
+
+        if (playout[cell] == Turn::Red)
+            red++;
+    }
+
+    ASSERT_EQ(blue, 13);
+    ASSERT_EQ(red, 12);
+    ASSERT_EQ(playout[board.cell(2, 2)], Turn::Blue);
+    ASSERT_EQ(playout[board.cell(1, 3)], Turn::Red);
+}
+
+TEST(PlayoutTests, blueWins) {
+    Board board(3, HumanPlayers({true, true}));
+
+    board.set(0, 0);
+    board.set(2, 0);
+    board.set(0, 1);
+    board.set(2, 1);
+    board.set(1, 0);
+    board.set(2, 2);
+    board.set(1, 1);
+    board.set(1, 2);
+
+    Playout playout;
+    Random random(1);
+
+    ASSERT_EQ(playout.run(board, random), Turn::Blue);
+}
+
+TEST(PlayoutTests, redWins) {
+    Board board(3, HumanPlayers({true, true}));
+
+    board.set(0, 0);
+    board.set(0, 1);
+    board.set(0, 2);
+    board.set(1, 1);
+    board.set(2, 2);
+    board.set(2, 1);
+
+    Playout playout;
+    Random random(1);
+
+    ASSERT_EQ(playout.run(board, random), Turn::Red);
+}
+
+TEST(PlayoutTests, bridgesFillBoard) {
+    Board board(5, HumanPlayers({true, true}));
+
+    board.set(2, 2);
+    board.set(1, 3);
+    board.set(3, 1);
+
+    Playout playout(true);
+    Random random(1);
+    playout.run(board, random);
+
+    int blue = 0;
+
+    for (int cell = 0; cell < 25; ++cell) {
+        ASSERT_NE(playout[cell], Turn::Undecided);
+
+        if (playout[cell] == Turn::Blue)
+            blue++;
+    }
+
+    ASSERT_EQ(blue, 13);
+}
+
+TEST(PlayoutTests, bridgesAreAnswered) {
+    Board board(5, HumanPlayers({true, true}));
+
+    // Blue bridge between (2,1) and (1,3), through (1,2) and (2,2)
+    board.set(2, 1);
+    board.set(4, 4);
+    board.set(1, 3);
+    board.set(0, 0);
+
+    Playout plain;
+    Playout bridges(true);
+    Random random(1);
+
+    int plainKept = 0;
+    int bridgesKept = 0;
+
+    for (int i = 0; i < 200; ++i) {
+        plain.run(board, random);
+        bridges.run(board, random);
+
+        if (plain[board.cell(1, 2)] == Turn::Blue || plain[board.cell(2, 2)] == Turn::Blue)
+            plainKept++;
+
+        if (bridges[board.cell(1, 2)] == Turn::Blue || bridges[board.cell(2, 2)] == Turn::Blue)
+            bridgesKept++;
+    }
+
+    // A single move can break into two bridges, and only one is saved
+    ASSERT_GE(bridgesKept, 190);
+    ASSERT_LT(plainKept, bridgesKept);
+}
+
+#endif // __PLAYOUT_TEST__
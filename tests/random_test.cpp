@@ -0,0 +1,41 @@
+#ifndef __RANDOM_TEST__
+#define __RANDOM_TEST__
+
+#include <gtest/gtest.h>
+#include "../src/random.hpp"
+
+TEST(RandomTests, seed) {
+    Random a(42);
+    Random b(42);
+    Random c(43);
+
+    uint64_t first = a();
+
+    ASSERT_EQ(first, b());
+    ASSERT_NE(first, c());
+}
+
+TEST(RandomTests, below) {
+    Random random(7);
+
+    for (int i = 0; i < 1000; ++i) {
+        uint32_t value = random.below(6);
+
+        ASSERT_LT(value, 6);
+    }
+}
+
+TEST(RandomTests, flipCoin) {
+    Random random(7);
+    int heads = 0;
+
+    for (int i = 0; i < 1000; ++i) {
+        if (random.flipCoin())
+            heads++;
+    }
+
+    ASSERT_GT(heads, 400);
+    ASSERT_LT(heads, 600);
+}
+
+#endif // __RANDOM_TEST__
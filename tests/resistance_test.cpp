@@ -0,0 +1,106 @@
+#ifndef __RESISTANCE_TEST__
+#define __RESISTANCE_TEST__
+
+#include <cmath>
+#include <gtest/gtest.h>
+#include "../src/board.hpp"
+#include "../src/resistance.hpp"
+
+TEST(ResistanceEvaluatorTests, singleRow) {
+    // A 1x1 board is a single empty resistor between both borders
+    Board board(1, {true, true});
+    ResistanceEvaluator evaluator(1);
+
+    ASSERT_NEAR(evaluator.getResistance(board, Turn::Blue), 2.0, 1e-9);
+    ASSERT_NEAR(evaluator.getResistance(board, Turn::Red), 2.0, 1e-9);
+}
+
+TEST(ResistanceEvaluatorTests, symmetricEmptyBoard) {
+    Board board(5, {true, true});
+    ResistanceEvaluator evaluator(5);
+
+    double blue = evaluator.getResistance(board, Turn::Blue);
+    double red = evaluator.getResistance(board, Turn::Red);
+
+    ASSERT_GT(blue, 0.0);
+    ASSERT_NEAR(blue, red, 1e-6);
+    ASSERT_NEAR(evaluator.evaluate(board, Turn::Blue), 0.0, 1e-6);
+}
+
+TEST(ResistanceEvaluatorTests, stonesChangeTheResistance) {
+    Board board(5, {true, true});
+    ResistanceEvaluator evaluator(5);
+
+    double before = evaluator.getResistance(board, Turn::Blue);
+    board.set(2, 2);
+
+    ASSERT_LT(evaluator.getResistance(board, Turn::Blue), before);
+    ASSERT_GT(evaluator.getResistance(board, Turn::Red), before);
+    ASSERT_GT(evaluator.evaluate(board, Turn::Blue), 0.0);
+    ASSERT_LT(evaluator.evaluate(board, Turn::Red), 0.0);
+}
+
+TEST(ResistanceEvaluatorTests, finishedGame) {
+    Board board(3, {true, true});
+    ResistanceEvaluator evaluator(3);
+
+    // Red builds a full column while blue plays on the side
+    board.set(0, 0);
+    board.set(0, 1);
+    board.set(2, 0);
+    board.set(1, 1);
+    board.set(2, 2);
+    board.set(2, 1);
+
+    ASSERT_EQ(evaluator.getResistance(board, Turn::Red), 0.0);
+    ASSERT_TRUE(std::isinf(evaluator.getResistance(board, Turn::Blue)));
+}
+
+TEST(ResistanceEvaluatorTests, warmStart) {
+    Board board(11, {true, true});
+    ResistanceEvaluator evaluator(11);
+
+    evaluator.getResistance(board, Turn::Blue);
+    long long cold = evaluator.countIterations();
+
+    evaluator.getResistance(board, Turn::Blue);
+    long long warm = evaluator.countIterations() - cold;
+
+    ASSERT_GT(cold, 0);
+    ASSERT_LT(warm, cold);
+}
+
+TEST(ResistanceStrategyTests, takesTheWinningMove) {
+    Board board(3, {true, true});
+
+    // Blue to move, with (0,2) as the only cell that connects
+    board.set(0, 0);
+    board.set(2, 0);
+    board.set(0, 1);
+    board.set(2, 1);
+    board.set(1, 0);
+    board.set(1, 2);
+
+    ResistanceStrategy strategy(Turn::Blue, 1);
+
+    ASSERT_EQ(strategy.getNextMove(board), Position({0, 2}));
+}
+
+TEST(ResistanceStrategyTests, blocksTheWinningMove) {
+    Board board(3, {true, true});
+
+    // Red to move, and blue would connect through (0,2)
+    board.set(0, 0);
+    board.set(2, 0);
+    board.set(0, 1);
+    board.set(2, 1);
+    board.set(1, 0);
+    board.set(1, 2);
+    board.set(2, 2);
+
+    ResistanceStrategy strategy(Turn::Red, 1);
+
+    ASSERT_EQ(strategy.getNextMove(board), Position({0, 2}));
+}
+
+#endif
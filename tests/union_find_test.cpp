@@ -0,0 +1,51 @@
+#ifndef __UNION_FIND_TEST__
+#define __UNION_FIND_TEST__
+
+#include <gtest/gtest.h>
+#include "../src/union_find.hpp"
+
+TEST(UnionFindTests, countNodes) {
+    UnionFind sets(9);
+
+    ASSERT_EQ(sets.countNodes(), 9);
+}
+
+TEST(UnionFindTests, find) {
+    UnionFind sets(9);
+
+    ASSERT_EQ(sets.find(3), 3);
+
+    sets.unite(3, 4);
+
+    ASSERT_EQ(sets.find(3), sets.find(4));
+}
+
+TEST(UnionFindTests, connected) {
+    UnionFind sets(9);
+
+    sets.unite(0, 1);
+    sets.unite(1, 2);
+    sets.unite(5, 8);
+
+    ASSERT_EQ(sets.connected(0, 2), true);
+    ASSERT_EQ(sets.connected(2, 0), true);
+    ASSERT_EQ(sets.connected(5, 8), true);
+    ASSERT_EQ(sets.connected(0, 8), false);
+}
+
+TEST(UnionFindTests, reset) {
+    UnionFind sets(9);
+
+    sets.unite(0, 1);
+    sets.reset();
+
+    ASSERT_EQ(sets.connected(0, 1), false);
+}
+
+TEST(UnionFindTests, invalidNode) {
+    UnionFind sets(3);
+
+    ASSERT_THROW(sets.find(3), std::out_of_range);
+}
+
+#endif // __UNION_FIND_TEST__
@@ -1,9 +1,19 @@
 #include <gtest/gtest.h>
 
 #include "graph_test.cpp"
+#include "bounded_graph_test.cpp"
+#include "random_test.cpp"
+#include "union_find_test.cpp"
+#include "bitboard_test.cpp"
 #include "board_test.cpp"
 #include "dijkstra_test.cpp"
+#include "breadth_first_search_test.cpp"
+#include "playout_test.cpp"
 #include "ai_test.cpp"
+#include "mcts_test.cpp"
+#include "distance_evaluator_test.cpp"
+#include "resistance_test.cpp"
+#include "alpha_beta_test.cpp"
 
 int main(int argc, char **argv) {
     testing::InitGoogleTest(&argc, argv);